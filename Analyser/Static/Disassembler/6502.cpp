@@ -262,8 +262,11 @@ static void AddToDisassembly(
 			break;
 		}
 
-		// Store the instruction.
-		disassembly.disassembly.instructions_by_address[instruction.address] = instruction;
+		// Store the instruction; if it was already known then everything from here on has
+		// already been disassembled.
+		if(!disassembly.disassembly.instructions_by_address.try_emplace(instruction.address, instruction).second) {
+			return;
+		}
 
 		// TODO: something wider-ranging than this
 		if(
@@ -350,3 +353,17 @@ Disassembly Analyser::Static::MOS6502::Disassemble(
 		false
 	);
 }
+
+void Analyser::Static::MOS6502::Disassemble(
+	Disassembly &disassembly,
+	const std::vector<uint8_t> &memory,
+	const std::function<std::size_t(uint16_t)> &address_mapper,
+	std::vector<uint16_t> entry_points) {
+	Analyser::Static::Disassembly::Disassemble<Disassembly, uint16_t, MOS6502Disassembler>(
+		disassembly,
+		memory,
+		address_mapper,
+		entry_points,
+		false
+	);
+}
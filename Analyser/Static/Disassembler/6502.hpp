@@ -91,4 +91,14 @@ Disassembly Disassemble(
 	const std::function<std::size_t(uint16_t)> &address_mapper,
 	std::vector<uint16_t> entry_points);
 
+/*!
+	Extends @c disassembly, which must have been produced from the same @c memory and @c address_mapper, by
+	disassembling from each of @c entry_points; anything already disassembled is not revisited.
+*/
+void Disassemble(
+	Disassembly &disassembly,
+	const std::vector<uint8_t> &memory,
+	const std::function<std::size_t(uint16_t)> &address_mapper,
+	std::vector<uint16_t> entry_points);
+
 }
@@ -16,14 +16,22 @@ template <typename D, typename S> struct PartialDisassembly {
 	std::vector<S> implicit_entry_points;
 };
 
-template <typename D, typename S, typename Disassembler> D Disassemble(
+/*!
+	Extends @c disassembly, which must previously have been built from the same @c memory and @c address_mapper,
+	by disassembling from each of @c entry_points. Entry points that have already been visited are ignored and
+	disassembly from any other point stops upon meeting a previously-disassembled instruction, so work is never
+	repeated.
+*/
+template <typename D, typename S, typename Disassembler> void Disassemble(
+	D &disassembly,
 	const std::vector<uint8_t> &memory,
 	const std::function<std::size_t(S)> &address_mapper,
 	std::vector<S> entry_points,
 	bool exhaustive)
 {
 	PartialDisassembly<D, S> partial_disassembly;
-	partial_disassembly.remaining_entry_points = entry_points;
+	partial_disassembly.disassembly = std::move(disassembly);
+	partial_disassembly.remaining_entry_points = std::move(entry_points);
 
 	while(!partial_disassembly.remaining_entry_points.empty()) {
 		// Do a recursive-style disassembly for all current entry points.
@@ -60,7 +68,18 @@ template <typename D, typename S, typename Disassembler> D Disassemble(
 		partial_disassembly.implicit_entry_points.clear();
 	}
 
-	return partial_disassembly.disassembly;
+	disassembly = std::move(partial_disassembly.disassembly);
+}
+
+template <typename D, typename S, typename Disassembler> D Disassemble(
+	const std::vector<uint8_t> &memory,
+	const std::function<std::size_t(S)> &address_mapper,
+	std::vector<S> entry_points,
+	bool exhaustive)
+{
+	D disassembly;
+	Disassemble<D, S, Disassembler>(disassembly, memory, address_mapper, std::move(entry_points), exhaustive);
+	return disassembly;
 }
 
 }
@@ -595,8 +595,11 @@ struct Z80Disassembler {
 			// If any memory access was invalid, end disassembly.
 			if(accessor.overrun()) return;
 
-			// Store the instruction away.
-			disassembly.disassembly.instructions_by_address[instruction.address] = instruction;
+			// Store the instruction away; if it was already known then everything from here on
+			// has already been disassembled.
+			if(!disassembly.disassembly.instructions_by_address.try_emplace(instruction.address, instruction).second) {
+				return;
+			}
 
 			// Update access tables.
 			int access_type =
@@ -672,3 +675,19 @@ Disassembly Analyser::Static::Z80::Disassemble(
 		approach == Approach::Exhaustive
 	);
 }
+
+void Analyser::Static::Z80::Disassemble(
+	Disassembly &disassembly,
+	const std::vector<uint8_t> &memory,
+	const std::function<std::size_t(uint16_t)> &address_mapper,
+	std::vector<uint16_t> entry_points,
+	Approach approach)
+{
+	Analyser::Static::Disassembly::Disassemble<Disassembly, uint16_t, Z80Disassembler>(
+		disassembly,
+		memory,
+		address_mapper,
+		entry_points,
+		approach == Approach::Exhaustive
+	);
+}
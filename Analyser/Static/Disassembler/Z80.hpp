@@ -89,4 +89,15 @@ Disassembly Disassemble(
 	std::vector<uint16_t> entry_points,
 	Approach approach);
 
+/*!
+	Extends @c disassembly, which must have been produced from the same @c memory and @c address_mapper, by
+	disassembling from each of @c entry_points; anything already disassembled is not revisited.
+*/
+void Disassemble(
+	Disassembly &disassembly,
+	const std::vector<uint8_t> &memory,
+	const std::function<std::size_t(uint16_t)> &address_mapper,
+	std::vector<uint16_t> entry_points,
+	Approach approach);
+
 }
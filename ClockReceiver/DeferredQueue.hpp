@@ -9,42 +9,49 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
 #include <functional>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 /*!
 	Provides the logic to insert into and traverse a list of future scheduled items.
+
+	Actions are stored inline, in a ring buffer ordered by due time; no allocation occurs other than when the
+	buffer needs to grow. Actions must therefore be trivially copyable and no larger than @c ActionSize bytes —
+	in practice a lambda capturing @c this and a small value or two.
 */
-template <typename TimeUnit> class DeferredQueue {
+template <typename TimeUnit, std::size_t ActionSize = 3 * sizeof(void *)> class DeferredQueue {
 public:
 	/*!
 		Schedules @c action to occur in @c delay units of time.
 	*/
 	template <typename FuncT>
 	requires std::invocable<FuncT>
-	void defer(TimeUnit delay, FuncT &&action) {
+	void defer(const TimeUnit delay, FuncT &&action) {
 		// Apply immediately if there's no delay (or a negative delay).
 		if(delay <= TimeUnit(0)) {
 			action();
 			return;
 		}
 
-		if(!pending_actions_.empty()) {
-			// Otherwise enqueue, having subtracted the delay for any preceding events,
-			// and subtracting from the subsequent, if any.
-			auto insertion_point = pending_actions_.begin();
-			while(insertion_point != pending_actions_.end() && insertion_point->delay < delay) {
-				delay -= insertion_point->delay;
-				++insertion_point;
-			}
-			if(insertion_point != pending_actions_.end()) {
-				insertion_point->delay -= delay;
-			}
+		if(size_ == actions_.size()) {
+			grow();
+		}
 
-			pending_actions_.emplace(insertion_point, delay, std::forward<FuncT>(action));
-		} else {
-			pending_actions_.emplace_back(delay, std::forward<FuncT>(action));
+		// Find the insertion point, searching from the back since new actions are most
+		// often the furthest in the future. Any action scheduled for the same time as
+		// an existing one will be performed first.
+		const TimeUnit due = now_ + delay;
+		std::size_t insertion_point = size_;
+		while(insertion_point && at(insertion_point - 1).due >= due) {
+			at(insertion_point) = at(insertion_point - 1);
+			--insertion_point;
 		}
+		++size_;
+
+		at(insertion_point).set(due, std::forward<FuncT>(action));
 	}
 
 	/*!
@@ -52,56 +59,86 @@ public:
 			or TimeUnit(-1) if the queue is empty.
 	*/
 	TimeUnit time_until_next_action() const {
-		if(pending_actions_.empty()) return TimeUnit(-1);
-		return pending_actions_.front().delay;
+		if(!size_) return TimeUnit(-1);
+		return at(0).due - now_;
 	}
 
 	/*!
 		Advances the queue the specified amount of time, performing any actions it reaches.
 	*/
 	void advance(const TimeUnit time) {
-		auto remaining_time = time;
-		auto erase_iterator = pending_actions_.begin();
-		while(erase_iterator != pending_actions_.end()) {
-			erase_iterator->delay -= remaining_time;
-			if(erase_iterator->delay <= TimeUnit(0)) {
-				remaining_time = -erase_iterator->delay;
-				erase_iterator->action();
-				++erase_iterator;
-			} else {
-				break;
-			}
+		now_ += time;
+		while(size_ && at(0).due <= now_) {
+			// Pop before performing, so that the action is free to defer further actions.
+			const DeferredAction action = at(0);
+			head_ = (head_ + 1) & (actions_.size() - 1);
+			--size_;
+			action.perform();
 		}
-		if(erase_iterator != pending_actions_.begin()) {
-			pending_actions_.erase(pending_actions_.begin(), erase_iterator);
+
+		// Rebase time whenever the queue is empty, so that it can't grow without bound.
+		if(!size_) {
+			now_ = TimeUnit(0);
 		}
 	}
 
 	/// @returns @c true if no actions are enqueued; @c false otherwise.
 	bool empty() const {
-		return pending_actions_.empty();
+		return !size_;
 	}
 
 private:
-	// The list of deferred actions.
 	struct DeferredAction {
-		TimeUnit delay;
-		std::function<void(void)> action;
+		TimeUnit due;
+		void (*call)(const void *);
+		alignas(std::max_align_t) std::byte storage[ActionSize];
 
 		template <typename FuncT>
-		requires std::invocable<FuncT>
-		DeferredAction(TimeUnit delay, FuncT &&action) :
-			delay(delay), action(std::forward<FuncT>(action)) {}
+		void set(const TimeUnit due, FuncT &&action) {
+			using ActionT = std::decay_t<FuncT>;
+			static_assert(sizeof(ActionT) <= ActionSize, "Deferred action is too large to store inline");
+			static_assert(alignof(ActionT) <= alignof(std::max_align_t));
+			static_assert(std::is_trivially_copyable_v<ActionT>, "Deferred actions must be trivially copyable");
+
+			this->due = due;
+			new (storage) ActionT(std::forward<FuncT>(action));
+			call = [](const void *const storage) {
+				(*static_cast<const ActionT *>(storage))();
+			};
+		}
+
+		void perform() const {
+			call(storage);
+		}
 	};
-	std::vector<DeferredAction> pending_actions_;
+	static_assert(std::is_trivially_copyable_v<DeferredAction>);
+
+	// A ring buffer of pending actions, sorted by due time; its size is always a power of two.
+	std::vector<DeferredAction> actions_;
+	std::size_t head_ = 0, size_ = 0;
+	TimeUnit now_ = TimeUnit(0);
+
+	DeferredAction &at(const std::size_t index) {
+		return actions_[(head_ + index) & (actions_.size() - 1)];
+	}
+	const DeferredAction &at(const std::size_t index) const {
+		return actions_[(head_ + index) & (actions_.size() - 1)];
+	}
+
+	void grow() {
+		std::vector<DeferredAction> resized(actions_.empty() ? 8 : actions_.size() * 2);
+		for(std::size_t c = 0; c < size_; c++) {
+			resized[c] = at(c);
+		}
+		actions_ = std::move(resized);
+		head_ = 0;
+	}
 };
 
 /*!
 	A DeferredQueue maintains a list of ordered actions and the times at which
 	they should happen, and divides a total execution period up into the portions
 	that occur between those actions, triggering each action when it is reached.
-
-	This list is efficient only for short queues.
 */
 template <typename TimeUnit> class DeferredQueuePerformer: public DeferredQueue<TimeUnit> {
 public:
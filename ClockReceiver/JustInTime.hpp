@@ -12,6 +12,7 @@
 #include "Concurrency/AsyncTaskQueue.hpp"
 #include "ClockingHintSource.hpp"
 #include "ForceInline.hpp"
+#include "Profiler.hpp"
 
 #include <atomic>
 
@@ -32,7 +33,7 @@
 	observer and potentially stop clocking or stop delaying clocking until just-in-time references
 	as directed.
 
-	TODO: incorporate and codify AsyncJustInTimeActor.
+	See also AsyncJustInTimeActor, below.
 */
 template <class T, class LocalTimeScale = HalfCycles, int multiplier = 1, int divider = 1> class JustInTimeActor:
 	public ClockingHint::Observer
@@ -184,10 +185,12 @@ public:
 			did_flush_ = is_flushed_ = true;
 			if constexpr (divider == 1) {
 				const auto duration = time_since_update_.template flush<TargetTimeScale>();
+				const Profiler::Scope scope(Profiler::component_of<T>(), duration.get());
 				object_.run_for(duration);
 			} else {
 				const auto target_duration = time_since_update_.template divide<TargetTimeScale>(divider);
 				if(target_duration > TargetTimeScale(0)) {
+					const Profiler::Scope scope(Profiler::component_of<T>(), target_duration.get());
 					object_.run_for(target_duration);
 				}
 			}
@@ -291,54 +294,217 @@ private:
 };
 
 /*!
-	An AsyncJustInTimeActor acts like a JustInTimeActor but additionally contains an AsyncTaskQueue.
-	Any time the amount of accumulated time crosses a threshold provided at construction time,
-	the object will be updated on the AsyncTaskQueue.
+	An AsyncJustInTimeActor acts like a JustInTimeActor but runs the included object on a separate thread.
+
+	Time is accumulated locally and, once at least @c threshold has built up, is passed to the other thread.
+	Each such hand-off is allocation-free and at most one is ever enqueued; if the other thread is still busy
+	then further time is just added to its backlog. If that backlog exceeds @c maximum_lag then the caller
+	will wait for it to be worked off.
+
+	Any access via -> or flush() waits for the other thread to catch up and then pushes any remaining time
+	synchronously, so the included object is always fully up to date when seen by the caller.
+
+	The included object must therefore not share any state with its owner other than via calls made through ->.
+	E.g. a video chip that fetches from the machine's RAM as it runs would see the CPU's writes early, and is not
+	a candidate.
+
+	As per JustInTimeActor: if the held object implements @c next_sequence_point() then it'll be used to flush
+	implicitly as and when sequence points are hit, and if it is a subclass of ClockingHint::Source then this
+	template will stop clocking it when it requests no clocking and clock it synchronously when it requests
+	real-time clocking.
 */
 template <class T, class LocalTimeScale = HalfCycles, class TargetTimeScale = LocalTimeScale>
-class AsyncJustInTimeActor {
+class AsyncJustInTimeActor: public ClockingHint::Observer {
+private:
+	static constexpr bool has_sequence_points = requires(T &object) { object.next_sequence_point(); };
+	static constexpr bool is_clocking_hint_source = std::is_base_of_v<ClockingHint::Source, T>;
+
+	/// As per JustInTimeActor::SequencePointAwareDeleter.
+	class SequencePointAwareDeleter {
+	public:
+		explicit SequencePointAwareDeleter(AsyncJustInTimeActor *const actor) noexcept : actor_(actor) {}
+
+		forceinline void operator ()(const T *const) const {
+			if constexpr (has_sequence_points) {
+				actor_->update_sequence_point();
+			}
+		}
+
+	private:
+		AsyncJustInTimeActor *const actor_;
+	};
+
 public:
 	/// Constructs a new AsyncJustInTimeActor using the same construction arguments as the included object.
-	template<typename... Args> AsyncJustInTimeActor(const TargetTimeScale threshold, Args&&... args) :
+	template<typename... Args> AsyncJustInTimeActor(
+		const LocalTimeScale threshold,
+		const LocalTimeScale maximum_lag,
+		Args&&... args
+	) :
 		object_(std::forward<Args>(args)...),
-		threshold_(threshold) {}
+		threshold_(threshold),
+		maximum_lag_(maximum_lag)
+	{
+		if constexpr (is_clocking_hint_source) {
+			object_.set_clocking_hint_observer(this);
+		}
+	}
 
 	/// Adds time to the actor.
-	inline void operator += (const LocalTimeScale &rhs) {
+	///
+	/// @returns @c true if adding time caused a synchronous flush; @c false otherwise.
+	forceinline bool operator += (const LocalTimeScale rhs) {
+		if constexpr (is_clocking_hint_source) {
+			if(clocking_preference_ == ClockingHint::Preference::None) {
+				return false;
+			}
+		}
+
 		time_since_update_ += rhs;
+		is_flushed_ = false;
+
+		if constexpr (is_clocking_hint_source) {
+			if(clocking_preference_ == ClockingHint::Preference::RealTime) {
+				flush();
+				return true;
+			}
+		}
+
+		if constexpr (has_sequence_points) {
+			time_until_event_ -= rhs;
+			if(time_until_event_ <= LocalTimeScale(0)) {
+				flush();
+				update_sequence_point();
+				return true;
+			}
+		}
+
 		if(time_since_update_ >= threshold_) {
-			time_since_update_ -= threshold_;
-			task_queue_.enqueue([this] () {
-				object_.run_for(threshold_);
-			});
+			dispatch();
 		}
-		is_flushed_ = false;
+		return false;
 	}
 
 	/// Flushes all accumulated time and returns a pointer to the included object.
-	inline T *operator->() {
+	///
+	/// If this object provides sequence points, checks for changes to the next
+	/// sequence point upon deletion of the pointer.
+	[[nodiscard]] forceinline auto operator->() {
 		flush();
+		return std::unique_ptr<T, SequencePointAwareDeleter>(&object_, SequencePointAwareDeleter(this));
+	}
+
+	/// Acts exactly as per the standard ->, but preserves constness.
+	///
+	/// Despite being const, this will wait for the other thread, flush the object and, if relevant,
+	/// update the next sequence point.
+	[[nodiscard]] forceinline auto operator->() const {
+		auto non_const_this = const_cast<AsyncJustInTimeActor<T, LocalTimeScale, TargetTimeScale> *>(this);
+		non_const_this->flush();
+		return std::unique_ptr<const T, SequencePointAwareDeleter>(&object_, SequencePointAwareDeleter(non_const_this));
+	}
+
+	/// @returns a pointer to the included object, without flushing time.
+	///
+	/// The object may currently be running on another thread.
+	[[nodiscard]] forceinline T *get() {
 		return &object_;
 	}
 
-	/// Returns a pointer to the included object without flushing time.
-	inline T *get() {
+	/// @returns a pointer to the included object, without flushing time.
+	///
+	/// The object may currently be running on another thread.
+	[[nodiscard]] forceinline const T *get() const {
 		return &object_;
 	}
 
 	/// Flushes all accumulated time.
-	inline void flush() {
-		if(!is_flushed_) {
-			task_queue_.lock_flush();
-			object_.run_for(time_since_update_.template flush<TargetTimeScale>());
-			is_flushed_ = true;
+	///
+	/// This does not affect this actor's record of when the next sequence point will occur.
+	void flush() {
+		if(is_flushed_) {
+			return;
+		}
+
+		if(has_dispatched_) {
+			synchronise();
+		}
+		run_for(time_since_update_);
+		time_since_update_ = LocalTimeScale(0);
+		is_flushed_ = true;
+	}
+
+	/// Updates this template's record of the next sequence point.
+	void update_sequence_point() {
+		if constexpr (has_sequence_points) {
+			const auto time = object_.next_sequence_point();
+			if(time == TargetTimeScale::max()) {
+				time_until_event_ = LocalTimeScale::max();
+			} else {
+				time_until_event_ = time.template reduce<LocalTimeScale>();
+			}
+			assert(time_until_event_ > LocalTimeScale(0));
 		}
 	}
 
+	/// @returns A cached copy of the object's clocking preference.
+	ClockingHint::Preference clocking_preference() const {
+		return clocking_preference_;
+	}
+
 private:
 	T object_;
-	LocalTimeScale time_since_update_;
-	TargetTimeScale threshold_;
+	const LocalTimeScale threshold_, maximum_lag_;
+
+	// Caller-thread state.
+	LocalTimeScale time_since_update_, time_until_event_;
 	bool is_flushed_ = true;
+	bool has_dispatched_ = false;
+
+	// Time that has been handed off but not yet collected by the other thread, and a flag
+	// indicating whether a collection is already enqueued.
+	std::atomic<typename LocalTimeScale::IntType> backlog_ = 0;
+	std::atomic_flag is_scheduled_;
+
+	// Time that has been collected but not yet converted to TargetTimeScale; accessed only
+	// by whichever thread is currently running the object.
+	LocalTimeScale object_time_;
+
+	void run_for(const LocalTimeScale duration) {
+		object_time_ += duration;
+		const auto target_duration = object_time_.template flush<TargetTimeScale>();
+		const Profiler::Scope scope(Profiler::component_of<T>(), target_duration.get());
+		object_.run_for(target_duration);
+	}
+
+	void dispatch() {
+		const auto backlog = backlog_ += time_since_update_.get();
+		time_since_update_ = LocalTimeScale(0);
+		has_dispatched_ = true;
+
+		if(!is_scheduled_.test_and_set()) {
+			task_queue_.enqueue([this] {
+				is_scheduled_.clear();
+				run_for(LocalTimeScale(backlog_.exchange(0)));
+			});
+		}
+
+		if(backlog > maximum_lag_.get()) {
+			synchronise();
+		}
+	}
+
+	void synchronise() {
+		task_queue_.spin_flush();
+		has_dispatched_ = false;
+	}
+
+	std::atomic<ClockingHint::Preference> clocking_preference_ = ClockingHint::Preference::JustInTime;
+	void set_component_prefers_clocking(ClockingHint::Source *, const ClockingHint::Preference clocking) final {
+		clocking_preference_ = clocking;
+	}
+
+	// This is declared last so that it is destroyed first, completing any outstanding work
+	// while everything else remains valid.
 	Concurrency::AsyncTaskQueue<true> task_queue_;
 };
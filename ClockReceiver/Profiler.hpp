@@ -0,0 +1,188 @@
+//
+//  Profiler.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "TimeTypes.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+/*!
+	Provides an opt-in record of host time and emulated cycles per component of a machine,
+	printed to stderr approximately once per second of host time.
+
+	Profiling is compiled in only if CLK_PROFILE is defined; otherwise every part of this
+	interface compiles to nothing.
+
+	Scopes nest: each is charged only with time not spent within a scope opened inside it on
+	the same thread. The outermost scope is that of TimedMachine::run_for, so the CPU is
+	charged with the processor and with any bus logic that doesn't belong to a more
+	specific component.
+*/
+namespace Profiler {
+
+#ifdef CLK_PROFILE
+constexpr bool Enabled = true;
+#else
+constexpr bool Enabled = false;
+#endif
+
+enum class Component {
+	CPU,
+	Video,
+	Audio,
+	Disk,
+	Tape,
+	/// Actions performed by an AsyncTaskQueue, other than anything more specific.
+	Queue,
+	Other,
+
+	Count
+};
+
+constexpr const char *name(const Component component) {
+	switch(component) {
+		case Component::CPU:	return "CPU";
+		case Component::Video:	return "Video";
+		case Component::Audio:	return "Audio";
+		case Component::Disk:	return "Disk";
+		case Component::Tape:	return "Tape";
+		case Component::Queue:	return "Queue";
+		case Component::Other:	return "Other";
+		default:				return nullptr;
+	}
+}
+
+/*!
+	@returns The component that time spent running a @c T should be charged to: @c T::ProfilerComponent
+		if it is declared; otherwise @c Video for anything that outputs to a scan target and @c Other for everything else.
+*/
+template <typename T>
+constexpr Component component_of() {
+	if constexpr (requires { T::ProfilerComponent; }) {
+		return T::ProfilerComponent;
+	} else if constexpr (requires(T &object) { object.set_scan_target(nullptr); }) {
+		return Component::Video;
+	} else {
+		return Component::Other;
+	}
+}
+
+namespace Implementation {
+
+struct Totals {
+	std::atomic<Time::Nanos> nanos = 0;
+	std::atomic<int64_t> cycles = 0;
+	std::atomic<int64_t> calls = 0;
+};
+
+struct Record {
+	std::array<Totals, size_t(Component::Count)> components;
+	std::atomic<double> emulated_seconds = 0.0;
+	std::atomic<Time::Nanos> last_report = Time::nanos_now();
+};
+inline Record record;
+
+}
+
+template <bool enabled> class ScopeImpl;
+
+/// Charges the host time between its construction and destruction, less that of any nested scope,
+/// to @c component, along with @c cycles of emulated time.
+template <> class ScopeImpl<true> {
+public:
+	ScopeImpl(const Component component, const int64_t cycles = 0) :
+		component_(component), cycles_(cycles), parent_(current_), start_(Time::nanos_now())
+	{
+		current_ = this;
+	}
+
+	~ScopeImpl() {
+		current_ = parent_;
+
+		// A scope directly within one for the same component, e.g. a disk controller's own
+		// scope within that of the just-in-time actor that holds it, is merged into its parent.
+		if(parent_ && parent_->component_ == component_) {
+			parent_->nested_ += nested_;
+			return;
+		}
+
+		const auto duration = Time::nanos_now() - start_;
+		auto &totals = Implementation::record.components[size_t(component_)];
+		totals.nanos.fetch_add(duration - nested_, std::memory_order_relaxed);
+		totals.cycles.fetch_add(cycles_, std::memory_order_relaxed);
+		totals.calls.fetch_add(1, std::memory_order_relaxed);
+
+		if(parent_) parent_->nested_ += duration;
+	}
+
+	ScopeImpl(const ScopeImpl &) = delete;
+	ScopeImpl &operator =(const ScopeImpl &) = delete;
+
+private:
+	const Component component_;
+	const int64_t cycles_;
+	ScopeImpl *const parent_;
+	const Time::Nanos start_;
+	Time::Nanos nested_ = 0;
+
+	inline static thread_local ScopeImpl *current_ = nullptr;
+};
+
+template <> class ScopeImpl<false> {
+public:
+	ScopeImpl(Component, int64_t = 0) {}
+};
+
+using Scope = ScopeImpl<Enabled>;
+
+/*!
+	Records that @c seconds of emulated time have been run and, if at least a second of host time has
+	passed since the last report, prints a breakdown of the period since then and resets all totals.
+*/
+inline void did_run_for([[maybe_unused]] const Time::Seconds seconds) {
+	if constexpr (Enabled) {
+		using namespace Implementation;
+
+		auto emulated = record.emulated_seconds.load(std::memory_order_relaxed);
+		while(!record.emulated_seconds.compare_exchange_weak(emulated, emulated + seconds, std::memory_order_relaxed));
+
+		const auto now = Time::nanos_now();
+		auto last_report = record.last_report.load(std::memory_order_relaxed);
+		if(now - last_report < 1'000'000'000) return;
+		if(!record.last_report.compare_exchange_strong(last_report, now, std::memory_order_relaxed)) return;
+
+		emulated = record.emulated_seconds.exchange(0.0, std::memory_order_relaxed);
+		const double host = Time::seconds(now - last_report);
+		std::fprintf(stderr, "Profile: %0.3fs emulated in %0.3fs host\n", emulated, host);
+		std::fprintf(stderr, "  %-8s %12s %8s %16s %12s\n", "", "ms/emu s", "% host", "cycles/emu s", "calls/emu s");
+
+		for(size_t c = 0; c < size_t(Component::Count); c++) {
+			auto &totals = record.components[c];
+			const auto nanos = totals.nanos.exchange(0, std::memory_order_relaxed);
+			const auto cycles = totals.cycles.exchange(0, std::memory_order_relaxed);
+			const auto calls = totals.calls.exchange(0, std::memory_order_relaxed);
+			if(!calls) continue;
+
+			const double per_second = emulated > 0.0 ? 1.0 / emulated : 0.0;
+			std::fprintf(stderr, "  %-8s %12.3f %8.2f %16.0f %12.0f\n",
+				name(Component(c)),
+				double(nanos) * 1e-6 * per_second,
+				Time::seconds(nanos) * 100.0 / host,
+				double(cycles) * per_second,
+				double(calls) * per_second
+			);
+		}
+	}
+}
+
+}
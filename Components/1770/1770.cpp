@@ -452,6 +452,11 @@ void WD1770::posit_event(const int new_event_type) {
 
 		distance_into_section_ = 0;
 		set_data_mode(DataMode::Scanning);
+		skip_to_sector([&](const Storage::Encodings::MFM::Sector &sector) {
+			return
+				sector.address.track == track_ && sector.address.sector == sector_ &&
+				(has_motor_on_line() || !(command_&0x02) || ((command_&0x08) >> 3) == sector.address.side);
+		});
 
 	type2_get_header:
 		WAIT_FOR_EVENT(int(Event::IndexHole) | int(Event::Token));
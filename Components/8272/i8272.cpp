@@ -336,6 +336,11 @@ void i8272::posit_event(const int event_type) {
 		// values in the internal registers.
 			index_hole_limit_ = 2;
 //			Logger::info().append("Seeking " << PADDEC(0) << cylinder_ << " " << head_ " " << sector_ << " " << size_);
+			skip_to_sector([&](const Storage::Encodings::MFM::Sector &sector) {
+				return
+					sector.address.track == cylinder_ && sector.address.side == head_ &&
+					sector.address.sector == sector_ && sector.size == size_;
+			});
 		find_next_sector:
 			FIND_HEADER();
 			if(!index_hole_limit_) {
@@ -12,6 +12,7 @@
 
 #include "ClockReceiver/ClockReceiver.hpp"
 #include "Numeric/BitReverse.hpp"
+#include "Numeric/BitSpread.hpp"
 #include "Outputs/CRT/CRT.hpp"
 
 #include "AccessEnums.hpp"
@@ -10,6 +10,32 @@
 
 namespace TI::TMS {
 
+// MARK: - Pattern expansion helpers.
+//
+// Each of these expands pattern bytes to one nibble per pixel, with the leftmost pixel in the
+// most-significant nibble, so that drawing loops need only shift a word rather than select bits.
+
+/// @returns Eight four-bit pixels formed from the four Master System-style bit planes in @c planes.
+inline uint32_t chunky_pixels(const uint8_t *const planes) {
+	return
+		Numeric::spread_nibbles(planes[0]) |
+		(Numeric::spread_nibbles(planes[1]) << 1) |
+		(Numeric::spread_nibbles(planes[2]) << 2) |
+		(Numeric::spread_nibbles(planes[3]) << 3);
+}
+
+/// @returns Eight four-bit colour indices, being @c foreground wherever @c pattern has a bit set
+/// and @c background elsewhere.
+inline uint32_t two_colour_pixels(const uint8_t pattern, const uint32_t foreground, const uint32_t background) {
+	// As foreground ^ background fits in a nibble, the multiplication can't carry between pixels.
+	return (background * 0x1111'1111) ^ (Numeric::spread_nibbles(pattern) * (foreground ^ background));
+}
+
+/// @returns Sixteen pixels, each either 0 or 1, from the TMS-style sprite pattern bytes @c image[0] and @c image[1].
+inline uint64_t sprite_pixels(const uint8_t *const image) {
+	return (uint64_t(Numeric::spread_nibbles(image[0])) << 32) | Numeric::spread_nibbles(image[1]);
+}
+
 // MARK: - Sprites, as generalised.
 
 template <Personality personality>
@@ -54,15 +80,12 @@ void Base<personality>::draw_sprites(
 
 			const int pixel_start = std::max(start, sprite.x);
 
-			// TODO: it feels like the work below should be simplifiable;
-			// the double shift in particular, and hopefully the variable shift.
+			// Convert from planar to chunky once, with the leftmost pixel in the top nibble.
+			const uint32_t image = chunky_pixels(sprite.image);
+
 			for(int c = pixel_start; c < end && sprite.shift_position < 16; ++c) {
 				const int shift = (sprite.shift_position >> 1);
-				const int sprite_colour =
-					(((sprite.image[3] << shift) & 0x80) >> 4) |
-					(((sprite.image[2] << shift) & 0x80) >> 5) |
-					(((sprite.image[1] << shift) & 0x80) >> 6) |
-					(((sprite.image[0] << shift) & 0x80) >> 7);
+				const int sprite_colour = (image << (shift << 2)) >> 28;
 
 				if(sprite_colour) {
 					sprite_collision |= sprite_buffer[c];
@@ -122,30 +145,25 @@ void Base<personality>::draw_sprites(
 		}
 
 		if(!start) {
-			// Pre-rasterise the sprites one-by-one.
-			if(sprites_magnified_) {
-				for(int index = min_sprite; index < buffer.active_sprite_slot; index++) {
-					auto &sprite = buffer.active_sprites[index];
-					for(int c = 0; c < 32; c+= 2) {
-						const int shift = (c >> 1) ^ 7;
-						const int bit = 1 & (sprite.image[shift >> 3] >> (shift & 7));
-
-						Storage<personality>::sprite_cache_[index][c] =
-						Storage<personality>::sprite_cache_[index][c + 1] =
-							(sprite.image[2] & 0xf & sprite_colour_selection_masks[bit]) |
-							uint8_t((bit << StatusSpriteCollisionShift) & sprite.collision_bit());
-					}
-				}
-			} else {
-				for(int index = min_sprite; index < buffer.active_sprite_slot; index++) {
-					auto &sprite = buffer.active_sprites[index];
-					for(int c = 0; c < 16; c++) {
-						const int shift = c ^ 7;
-						const int bit = 1 & (sprite.image[shift >> 3] >> (shift & 7));
-
-						Storage<personality>::sprite_cache_[index][c] =
-							(sprite.image[2] & 0xf & sprite_colour_selection_masks[bit]) |
-							uint8_t((bit << StatusSpriteCollisionShift) & sprite.collision_bit());
+			// Pre-rasterise the sprites one-by-one. Each sprite's pattern is expanded once to a
+			// nibble per pixel; multiplying by its colour then gives the colour of every pixel.
+			const int pixel_step = sprites_magnified_ ? 2 : 1;
+			for(int index = min_sprite; index < buffer.active_sprite_slot; index++) {
+				auto &sprite = buffer.active_sprites[index];
+				uint64_t pixels = sprite_pixels(sprite.image);
+				uint64_t colours = pixels * (sprite.image[2] & 0xf);
+				const int collision_bit = sprite.collision_bit();
+
+				for(int c = 0; c < 16 * pixel_step; c += pixel_step) {
+					const uint8_t colour =
+						uint8_t(colours >> 60) |
+						uint8_t(int(pixels >> (60 - StatusSpriteCollisionShift)) & collision_bit);
+					colours <<= 4;
+					pixels <<= 4;
+
+					Storage<personality>::sprite_cache_[index][c] = colour;
+					if(sprites_magnified_) {
+						Storage<personality>::sprite_cache_[index][c + 1] = colour;
 					}
 				}
 			}
@@ -220,9 +238,10 @@ void Base<personality>::draw_sprites(
 			}
 
 			const int pixel_start = std::max(start, sprite.x);
+			const uint64_t image = sprite_pixels(sprite.image);
 			for(int c = pixel_start; c < end && sprite.shift_position < shifter_target; ++c) {
-				const int shift = (sprite.shift_position >> 1) ^ 7;
-				int sprite_colour = (sprite.image[shift >> 3] >> (shift & 7)) & 1;
+				const int shift = sprite.shift_position >> 1;
+				int sprite_colour = int((image << (shift << 2)) >> 60);
 
 				// A colision is detected regardless of sprite colour ...
 				sprite_collision |= sprite_buffer[c] & sprite_colour;
@@ -265,43 +284,44 @@ void Base<personality>::draw_tms_character(const int start, const int end) {
 	auto &line_buffer = *draw_line_buffer_;
 
 	// Paint the background tiles.
+	const auto &active_palette = palette();
 	const int pixels_left = end - start;
 	if(this->screen_mode_ == ScreenMode::MultiColour) {
 		for(int c = start; c < end; ++c) {
-			pixel_target_[c] = palette()[
+			pixel_target_[c] = active_palette[
 				(line_buffer.tiles.patterns[c >> 3][0] >> (((c & 4)^4))) & 15
 			];
 		}
 	} else {
+		// Each tile's pattern byte is expanded once to eight colour indices, with the leftmost in the top nibble.
+		const auto tile_pixels = [&](const int column) {
+			const uint8_t colour = line_buffer.tiles.patterns[column][1];
+			return two_colour_pixels(
+				line_buffer.tiles.patterns[column][0],
+				(colour >> 4) ? (colour >> 4) : background_colour_,
+				(colour & 15) ? (colour & 15) : background_colour_
+			);
+		};
+
 		const int shift = start & 7;
 		int byte_column = start >> 3;
 
 		int length = std::min(pixels_left, 8 - shift);
-
-		int pattern = Numeric::bit_reverse(line_buffer.tiles.patterns[byte_column][0]) >> shift;
-		uint8_t colour = line_buffer.tiles.patterns[byte_column][1];
-		uint32_t colours[2] = {
-			palette()[(colour & 15) ? (colour & 15) : background_colour_],
-			palette()[(colour >> 4) ? (colour >> 4) : background_colour_]
-		};
+		uint32_t pattern = tile_pixels(byte_column) << (shift << 2);
 
 		int background_pixels_left = pixels_left;
 		while(true) {
 			background_pixels_left -= length;
 			for(int c = 0; c < length; ++c) {
-				pixel_target_[c] = colours[pattern&0x01];
-				pattern >>= 1;
+				pixel_target_[c] = active_palette[pattern >> 28];
+				pattern <<= 4;
 			}
 			pixel_target_ += length;
 
 			if(!background_pixels_left) break;
 			length = std::min(8, background_pixels_left);
 			byte_column++;
-
-			pattern = Numeric::bit_reverse(line_buffer.tiles.patterns[byte_column][0]);
-			colour = line_buffer.tiles.patterns[byte_column][1];
-			colours[0] = palette()[(colour & 15) ? (colour & 15) : background_colour_];
-			colours[1] = palette()[(colour >> 4) ? (colour >> 4) : background_colour_];
+			pattern = tile_pixels(byte_column);
 		}
 	}
 
@@ -312,39 +332,43 @@ template <Personality personality>
 template <bool apply_blink>
 void Base<personality>::draw_tms_text(const int start, const int end) {
 	auto &line_buffer = *draw_line_buffer_;
+	const auto &active_palette = palette();
 	uint32_t colours[2][2] = {
-		{palette()[background_colour_], palette()[text_colour_]},
+		{background_colour_, text_colour_},
 		{0, 0}
 	};
 	if constexpr (apply_blink) {
-		colours[1][0] = palette()[Storage<personality>::blink_background_colour_];
-		colours[1][1] = palette()[Storage<personality>::blink_text_colour_];
+		colours[1][0] = Storage<personality>::blink_background_colour_;
+		colours[1][1] = Storage<personality>::blink_text_colour_;
 	}
 
+	// Each character's shape byte is expanded once to colour indices, with the leftmost in the top nibble;
+	// only the top six are used.
+	const auto character_pixels = [&](const int column) {
+		int flag = 0;
+		if constexpr (apply_blink) {
+			flag = (line_buffer.characters.flags[column >> 3] >> ((column & 7) ^ 7)) & Storage<personality>::in_blink_;
+		}
+		return two_colour_pixels(line_buffer.characters.shapes[column], colours[flag][1], colours[flag][0]);
+	};
+
 	const int shift = start % 6;
 	int byte_column = start / 6;
-	int pattern = Numeric::bit_reverse(line_buffer.characters.shapes[byte_column]) >> shift;
+	uint32_t pattern = character_pixels(byte_column) << (shift << 2);
 	int pixels_left = end - start;
 	int length = std::min(pixels_left, 6 - shift);
-	int flag = 0;
-	if constexpr (apply_blink) {
-		flag = (line_buffer.characters.flags[byte_column >> 3] >> ((byte_column & 7) ^ 7)) & Storage<personality>::in_blink_;
-	}
 	while(true) {
 		pixels_left -= length;
 		for(int c = 0; c < length; ++c) {
-			pixel_target_[c] = colours[flag][(pattern&0x01)];
-			pattern >>= 1;
+			pixel_target_[c] = active_palette[pattern >> 28];
+			pattern <<= 4;
 		}
 		pixel_target_ += length;
 
 		if(!pixels_left) break;
 		length = std::min(6, pixels_left);
 		byte_column++;
-		pattern = Numeric::bit_reverse(line_buffer.characters.shapes[byte_column]);
-		if constexpr (apply_blink) {
-			flag = (line_buffer.characters.flags[byte_column >> 3] >> ((byte_column & 7) ^ 7)) & Storage<personality>::in_blink_;
-		}
+		pattern = character_pixels(byte_column);
 	}
 }
 
@@ -377,13 +401,13 @@ void Base<personality>::draw_sms(
 		}
 
 
-		uint32_t pattern;
-		uint8_t *const pattern_index = reinterpret_cast<uint8_t *>(&pattern);
-
 		/*
 			Add background tiles; these will fill the colour_buffer with values in which
 			the low five bits are a palette index, and bit six is set if this tile has
 			priority over sprites.
+
+			Each tile's four bit planes are converted to chunky form up front, giving eight
+			four-bit pixels in a single word, with the leftmost in the top nibble.
 		*/
 		if(tile_start < end) {
 			const int shift = tile_start & 7;
@@ -391,35 +415,25 @@ void Base<personality>::draw_sms(
 			int pixels_left = tile_end - tile_start;
 			int length = std::min(pixels_left, 8 - shift);
 
-			pattern = *reinterpret_cast<const uint32_t *>(line_buffer.tiles.patterns[byte_column]);
+			uint32_t pattern = chunky_pixels(line_buffer.tiles.patterns[byte_column]);
 			if(line_buffer.tiles.flags[byte_column]&2)
-				pattern >>= shift;
+				pattern >>= shift << 2;
 			else
-				pattern <<= shift;
+				pattern <<= shift << 2;
 
 			while(true) {
 				const int palette_offset = (line_buffer.tiles.flags[byte_column]&0x18) << 1;
 				if(line_buffer.tiles.flags[byte_column]&2) {
 					for(int c = 0; c < length; ++c) {
-						colour_buffer[tile_offset] =
-							((pattern_index[3] & 0x01) << 3) |
-							((pattern_index[2] & 0x01) << 2) |
-							((pattern_index[1] & 0x01) << 1) |
-							((pattern_index[0] & 0x01) << 0) |
-							palette_offset;
+						colour_buffer[tile_offset] = int(pattern & 0xf) | palette_offset;
 						++tile_offset;
-						pattern >>= 1;
+						pattern >>= 4;
 					}
 				} else {
 					for(int c = 0; c < length; ++c) {
-						colour_buffer[tile_offset] =
-							((pattern_index[3] & 0x80) >> 4) |
-							((pattern_index[2] & 0x80) >> 5) |
-							((pattern_index[1] & 0x80) >> 6) |
-							((pattern_index[0] & 0x80) >> 7) |
-							palette_offset;
+						colour_buffer[tile_offset] = int(pattern >> 28) | palette_offset;
 						++tile_offset;
-						pattern <<= 1;
+						pattern <<= 4;
 					}
 				}
 
@@ -428,7 +442,7 @@ void Base<personality>::draw_sms(
 
 				length = std::min(8, pixels_left);
 				byte_column++;
-				pattern = *reinterpret_cast<const uint32_t *>(line_buffer.tiles.patterns[byte_column]);
+				pattern = chunky_pixels(line_buffer.tiles.patterns[byte_column]);
 			}
 		}
 
@@ -512,16 +526,24 @@ void Base<personality>::draw_yamaha(const uint8_t y, int start, int end) {
 	}
 
 	if constexpr (mode == ScreenMode::YamahaGraphics7) {
+		// Graphics 7 bytes are direct colours, so are mapped through a table of all 256 possibilities.
+		static constexpr auto graphics7_palette = [] {
+			std::array<uint32_t, 256> palette{};
+			for(int c = 0; c < 256; c++) {
+				palette[size_t(c)] = palette_pack(
+					uint8_t((c & 0x1c) + ((c & 0x1c) << 3) + ((c & 0x1c) >> 3)),
+					uint8_t((c & 0xe0) + ((c & 0xe0) >> 3) + ((c & 0xe0) >> 6)),
+					uint8_t((c & 0x03) + ((c & 0x03) << 2) + ((c & 0x03) << 4) + ((c & 0x03) << 6))
+				);
+			}
+			return palette;
+		}();
+
 		start >>= 2;
 		end >>= 2;
 
 		while(start < end) {
-			pixel_target_[start] =
-				palette_pack(
-					uint8_t((line_buffer.bitmap[start] & 0x1c) + ((line_buffer.bitmap[start] & 0x1c) << 3) + ((line_buffer.bitmap[start] & 0x1c) >> 3)),
-					uint8_t((line_buffer.bitmap[start] & 0xe0) + ((line_buffer.bitmap[start] & 0xe0) >> 3) + ((line_buffer.bitmap[start] & 0xe0) >> 6)),
-					uint8_t((line_buffer.bitmap[start] & 0x03) + ((line_buffer.bitmap[start] & 0x03) << 2) + ((line_buffer.bitmap[start] & 0x03) << 4) + ((line_buffer.bitmap[start] & 0x03) << 6))
-				);
+			pixel_target_[start] = graphics7_palette[line_buffer.bitmap[start]];
 			++start;
 		}
 	}
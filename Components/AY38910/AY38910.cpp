@@ -6,10 +6,12 @@
 //  Copyright 2016 Thomas Harte. All rights reserved.
 //
 
-#include <cmath>
-
 #include "AY38910.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 using namespace GI::AY38910;
 
 // Note on dividers: the real AY has a built-in divider of 8
@@ -158,6 +160,75 @@ void AY38910SampleSource<is_stereo>::advance() {
 	evaluate_output_volume();
 }
 
+namespace {
+
+/// Runs @c counter, which counts down to zero and then reloads with @c reload, for @c steps steps.
+/// @returns The number of times the counter was reloaded.
+int count_down(int &counter, const int reload, int steps) {
+	if(counter >= steps) {
+		counter -= steps;
+		return 0;
+	}
+
+	steps -= counter + 1;
+	counter = reload - (steps % (reload + 1));
+	return 1 + (steps / (reload + 1));
+}
+
+}
+
+template <bool is_stereo>
+void AY38910SampleSource<is_stereo>::advance(const int steps) {
+	// Tone channels just toggle upon each reload.
+	tone_outputs_[0] ^= count_down(tone_counters_[0], tone_periods_[0] << 1, steps) & 1;
+	tone_outputs_[1] ^= count_down(tone_counters_[1], tone_periods_[1] << 1, steps) & 1;
+	tone_outputs_[2] ^= count_down(tone_counters_[2], tone_periods_[2] << 1, steps) & 1;
+
+	// The noise generator needs to be run for real.
+	auto noise_steps = count_down(noise_counter_, noise_period_ << 1, steps);
+	while(noise_steps--) {
+		noise_output_ ^= noise_shift_register_&1;
+		noise_shift_register_ |= ((noise_shift_register_ ^ (noise_shift_register_ >> 3))&1) << 17;
+		noise_shift_register_ >>= 1;
+	}
+
+	// Envelopes either cycle through all 64 positions, or else lock to the final one.
+	const auto envelope_steps = count_down(envelope_divider_, envelope_period_ << 1, steps);
+	if(envelope_overflow_masks_[output_registers_[13]]) {
+		envelope_position_ = std::min(envelope_position_ + envelope_steps, 63);
+	} else {
+		envelope_position_ = (envelope_position_ + envelope_steps) & 63;
+	}
+
+	evaluate_output_volume();
+}
+
+template <bool is_stereo>
+int AY38910SampleSource<is_stereo>::stable_steps() const {
+	// Output can change only when a tone, noise or envelope counter reloads,
+	// and then only if that counter is feeding a channel that is audible.
+	int steps = std::numeric_limits<int>::max();
+	bool noise_is_audible = false;
+	bool envelope_is_audible = false;
+	for(int c = 0; c < 3; c++) {
+		const uint8_t volume = output_registers_[8 + c];
+		if(volume & 0x10) {
+			envelope_is_audible = true;
+		} else if(!(volume & 0xf)) {
+			continue;
+		}
+
+		if(!(output_registers_[7] & (1 << c))) {
+			steps = std::min(steps, tone_counters_[c]);
+		}
+		noise_is_audible |= !(output_registers_[7] & (8 << c));
+	}
+
+	if(noise_is_audible) steps = std::min(steps, noise_counter_);
+	if(envelope_is_audible) steps = std::min(steps, envelope_divider_);
+	return steps;
+}
+
 template <bool is_stereo>
 typename Outputs::Speaker::SampleT<is_stereo>::type AY38910SampleSource<is_stereo>::level() const {
 	return output_volume_;
@@ -244,8 +315,10 @@ void AY38910SampleSource<is_stereo>::set_register_value(const uint8_t value) {
 	if(selected_register_ > 15) return;
 
 	// If this is a register that affects audio output, enqueue a mutation onto the
-	// audio generation thread.
-	if(selected_register_ < 14) {
+	// audio generation thread. Rewrites of an unchanged value can be skipped other than
+	// for register 13, for which any write restarts the envelope. Music players
+	// commonly rewrite every register upon every update.
+	if(selected_register_ < 14 && (selected_register_ == 13 || registers_[selected_register_] != value)) {
 		task_queue_.enqueue([this, selected_register = selected_register_, value] () {
 			// Perform any register-specific mutation to output generation.
 			uint8_t masked_value = value;
@@ -337,6 +410,11 @@ void AY38910SampleSource<is_stereo>::set_port_handler(PortHandler *const handler
 	set_port_output(false);
 }
 
+template <bool is_stereo>
+uint8_t AY38910SampleSource<is_stereo>::get_selected_register() const {
+	return uint8_t(selected_register_);
+}
+
 template <bool is_stereo>
 void AY38910SampleSource<is_stereo>::set_data_input(const uint8_t r) {
 	data_input_ = r;
@@ -407,6 +485,8 @@ void AY38910SampleSource<is_stereo>::reset() {
 
 	task_queue_.enqueue([&] {
 		std::fill_n(output_registers_, 16, 0);
+		std::fill_n(tone_periods_, 3, 0);
+		noise_period_ = envelope_period_ = 0;
 		evaluate_output_volume();
 	});
 }
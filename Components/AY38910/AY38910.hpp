@@ -13,6 +13,8 @@
 
 #include "Reflection/Struct.hpp"
 
+#include <algorithm>
+
 namespace GI::AY38910 {
 
 /*!
@@ -93,6 +95,9 @@ public:
 	*/
 	uint8_t get_port_output(bool port_b) const;
 
+	/// @returns The number of the currently-selected register.
+	uint8_t get_selected_register() const;
+
 	/*!
 		Sets the port handler, which will receive a call every time the AY either wants to sample
 		input or else declare new output. As a convenience, current port output can be obtained
@@ -115,6 +120,8 @@ public:
 	// Sample generation.
 	typename Outputs::Speaker::SampleT<stereo>::type level() const;
 	void advance();
+	int stable_steps() const;
+	void advance(int steps);
 	bool is_zero_level() const;
 	void set_sample_volume_range(std::int16_t range);
 
@@ -223,6 +230,13 @@ struct State: public Reflection::StructImpl<State> {
 
 	// TODO: all audio-production thread state.
 
+	State() {}
+
+	template <typename AY> State(const AY &source) : State() {
+		std::copy(std::begin(source.registers_), std::end(source.registers_), std::begin(registers));
+		selected_register = uint8_t(source.selected_register_);
+	}
+
 	template <typename AY> void apply(AY &target) {
 		// Establish emulator-thread state
 		for(uint8_t c = 0; c < 16; c++) {
@@ -232,6 +246,18 @@ struct State: public Reflection::StructImpl<State> {
 		target.select_register(selected_register);
 	}
 
+	/// Applies only those registers that differ from @c target's current values; in particular
+	/// this avoids restarting the envelope if its shape is unchanged.
+	template <typename AY> void apply_changes(AY &target) {
+		for(uint8_t c = 0; c < 16; c++) {
+			if(target.registers_[c] != registers[c]) {
+				target.select_register(c);
+				target.set_register_value(registers[c]);
+			}
+		}
+		target.select_register(selected_register);
+	}
+
 private:
 	friend Reflection::StructImpl<State>;
 	void declare_fields() {
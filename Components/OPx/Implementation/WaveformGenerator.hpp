@@ -23,12 +23,6 @@ public:
 		@returns The output of waveform @c form at [integral] phase @c phase.
 	*/
 	static constexpr LogSign wave(const Waveform form, const int phase) {
-		int waveforms[4][4] = {
-			{1023, 1023, 1023, 1023},	// Sine: don't mask in any quadrant.
-			{511, 511, 0, 0},			// Half sine: keep the first half intact, lock to 0 in the second half.
-			{511, 511, 511, 511},		// AbsSine: endlessly repeat the first half of the sine wave.
-			{255, 0, 255, 0},			// PulseSine: act as if the first quadrant is in the first and third; lock the other two to 0.
-		};
 		return negative_log_sin(phase & waveforms[int(form)][(phase >> 8) & 3]);
 	}
 
@@ -76,6 +70,13 @@ public:
 	}
 
 private:
+	static constexpr int waveforms[4][4] = {
+		{1023, 1023, 1023, 1023},	// Sine: don't mask in any quadrant.
+		{511, 511, 0, 0},			// Half sine: keep the first half intact, lock to 0 in the second half.
+		{511, 511, 511, 511},		// AbsSine: endlessly repeat the first half of the sine wave.
+		{255, 0, 255, 0},			// PulseSine: act as if the first quadrant is in the first and third; lock the other two to 0.
+	};
+
 	/*!
 		@returns The phase bit used for cymbal and high-hat generation, which is a function of two operators' phases.
 	*/
@@ -8,15 +8,16 @@
 
 #include "OPLL.hpp"
 
+#include <algorithm>
 #include <cassert>
 
 using namespace Yamaha::OPL;
 
 OPLL::OPLL(Concurrency::AsyncTaskQueue<false> &task_queue, const int audio_divider, const bool is_vrc7):
 	OPLBase(task_queue), audio_divider_(audio_divider), is_vrc7_(is_vrc7) {
-	// Due to the way that sound mixing works on the OPLL, the audio divider may not
-	// be larger than 4.
-	assert(audio_divider <= 4);
+	// Due to the way that sound mixing works on the OPLL, the audio divider must be
+	// a divisor of 4: each channel is output for four cycles in every 72.
+	assert(audio_divider > 0 && !(4 % audio_divider));
 
 	// Setup the rhythm envelope generators.
 
@@ -281,18 +282,30 @@ void OPLL::set_sample_volume_range(const std::int16_t range) {
 template <Outputs::Speaker::Action action>
 void OPLL::apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target) {
 	// Both the OPLL and the OPL2 divide the input clock by 72 to get the base tick frequency;
-	// unlike the OPL2 the OPLL time-divides the output for 'mixing'.
+	// unlike the OPL2 the OPLL time-divides the output for 'mixing'. So output is a sequence of
+	// runs of a single channel's level, with all channels being updated at the start of every
+	// 18th run.
 
-	const int update_period = 72 / audio_divider_;
 	const int channel_output_period = 4 / audio_divider_;
+	const int update_period = 18 * channel_output_period;
 
-	// TODO: the conditional below is terrible. Fix.
-	while(number_of_samples--) {
+	while(number_of_samples) {
 		if(!audio_offset_) update_all_channels();
 
-		Outputs::Speaker::apply<action>(*target, output_levels_[audio_offset_ / channel_output_period]);
-		++target;
-		audio_offset_ = (audio_offset_ + 1) % update_period;
+		int slot = audio_offset_ / channel_output_period;
+		int slot_remainder = channel_output_period - (audio_offset_ % channel_output_period);
+		while(number_of_samples && slot < 18) {
+			const auto run = std::min(number_of_samples, std::size_t(slot_remainder));
+			Outputs::Speaker::fill<action>(target, target + run, output_levels_[slot]);
+			target += run;
+			number_of_samples -= run;
+			audio_offset_ += int(run);
+
+			++slot;
+			slot_remainder = channel_output_period;
+		}
+
+		if(audio_offset_ >= update_period) audio_offset_ = 0;
 	}
 }
 
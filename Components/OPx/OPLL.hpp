@@ -95,7 +95,7 @@ private:
 		int carrier_key_rate_scale_multiplier = 0;
 		int modulator_key_rate_scale_multiplier = 0;
 
-		LogSign modulator_output;
+		LogSign modulator_output{};
 		int modulator_feedback = 0;
 
 		bool use_sustain = false;
@@ -8,6 +8,8 @@
 
 #include "SID.hpp"
 
+#include <algorithm>
+
 // Sources used:
 //
 //	(1) SID Article v0.2 at https://github.com/ImreOlajos/SID-Article
@@ -174,12 +176,20 @@ bool Voice::Oscillator::did_raise_b19() const {
 }
 
 uint16_t Voice::Oscillator::sawtooth_output() const {
-	return (phase >> 20) ^ 0x800;
+	return sawtooth_output(phase);
+}
+
+uint16_t Voice::Oscillator::sawtooth_output(const uint32_t phase) {
+	return uint16_t((phase >> 20) ^ 0x800);
 }
 
 // MARK: - Noise generator.
 
 uint16_t Voice::NoiseGenerator::output() const {
+	return output(noise);
+}
+
+uint16_t Voice::NoiseGenerator::output(const uint32_t noise) {
 	// Uses bits: 20, 18, 14, 11, 9, 5, 2 and 0, plus four more zero bits.
 	const uint16_t output =
 		((noise >> 9) & 0b1000'0000'0000) |		// b20 -> b11
@@ -250,13 +260,13 @@ void Voice::update() {
 			noise_generator.update(test());
 		}
 	}
+}
 
-	// ADSR.
-
+void Voice::ADSR::tick() {
 	// First prescalar, which is a function of the programmer-set rate.
-	++ adsr.rate_counter;
-	if(adsr.rate_counter == adsr.rate_counter_target) {
-		adsr.rate_counter = 0;
+	++ rate_counter;
+	if(rate_counter == rate_counter_target) {
+		rate_counter = 0;
 
 		// Second prescalar, which approximates an exponential.
 		static constexpr uint8_t exponential_prescaler[] = {
@@ -297,27 +307,47 @@ void Voice::update() {
 		static_assert(exponential_prescaler[95] == 1);
 		static_assert(exponential_prescaler[255] == 1);
 
-		if(adsr.phase == ADSR::Phase::Attack) {
-			++adsr.envelope;
+		if(phase == Phase::Attack) {
+			++envelope;
 			// TODO: what really resets the exponential counter? If anything?
-			adsr.exponential_counter = 0;
+			exponential_counter = 0;
 
-			if(adsr.envelope == 0xff) {
-				adsr.set_phase(ADSR::Phase::DecayAndHold);
+			if(envelope == 0xff) {
+				set_phase(Phase::DecayAndHold);
 			}
 		} else {
-			++adsr.exponential_counter;
-			if(adsr.exponential_counter == exponential_prescaler[adsr.envelope]) {
-				adsr.exponential_counter = 0;
+			++exponential_counter;
+			if(exponential_counter == exponential_prescaler[envelope]) {
+				exponential_counter = 0;
 
-				if(adsr.envelope && (adsr.envelope != adsr.sustain || adsr.phase != ADSR::Phase::DecayAndHold)) {
-					--adsr.envelope;
+				if(envelope && (envelope != sustain || phase != Phase::DecayAndHold)) {
+					--envelope;
 				}
 			}
 		}
 	}
 }
 
+void Voice::ADSR::update(uint8_t *levels, std::size_t length) {
+	while(length) {
+		// The envelope can change only when the rate counter reaches its target, so
+		// output the current level in bulk up until that point.
+		const auto steps_to_target =
+			std::size_t(((rate_counter_target.get() - rate_counter.get() - 1) & Numeric::SizedInt<15>::Mask) + 1);
+		const auto run = std::min(steps_to_target - 1, length);
+		std::fill_n(levels, run, envelope);
+		rate_counter += decltype(rate_counter)::IntT(run);
+		levels += run;
+		length -= run;
+		if(!length) break;
+
+		tick();
+		*levels = envelope;
+		++levels;
+		--length;
+	}
+}
+
 void Voice::synchronise(const Voice &prior) {
 	// Only oscillator work to do here.
 	if(
@@ -328,14 +358,14 @@ void Voice::synchronise(const Voice &prior) {
 	}
 }
 
-uint16_t Voice::pulse_output() const {
+uint16_t Voice::pulse_output(const uint32_t phase) const {
 	return (
-		(oscillator.phase ^ 0x8000'0000) < oscillator.pulse_width
+		(phase ^ 0x8000'0000) < oscillator.pulse_width
 	) ? 0 : MaxWaveformValue;
 }
 
-uint16_t Voice::triangle_output(const Voice &prior) const {
-	const uint16_t sawtooth = oscillator.sawtooth_output();
+uint16_t Voice::triangle_output(const uint32_t phase, const Voice &prior) const {
+	const uint16_t sawtooth = Oscillator::sawtooth_output(phase);
 	const uint16_t xor_mask1 = sawtooth;
 	const uint16_t xor_mask2 = ring_mod() ? prior.sawtooth() : 0;
 	const uint16_t xor_mask = ((xor_mask1 ^ xor_mask2) & 0x800) ? 0xfff : 0x000;
@@ -343,6 +373,19 @@ uint16_t Voice::triangle_output(const Voice &prior) const {
 }
 
 uint16_t Voice::output(const Voice &prior) const {
+	uint16_t waveform;
+	waveforms(&waveform, &oscillator.phase, &noise_generator.noise, 1, prior);
+	return (waveform * adsr.envelope) / 255;
+}
+
+template <int waveform_bits>
+void Voice::waveforms(
+	uint16_t *const target,
+	const uint32_t *const phases,
+	const uint32_t *const noises,
+	const std::size_t length,
+	const Voice &prior
+) const {
 	// TODO: true composite waves.
 	//
 	// My current understanding on this: if multiple waveforms are enabled, the pull to zero beats the
@@ -351,14 +394,34 @@ uint16_t Voice::output(const Voice &prior) const {
 	//
 	// Anyway, first pass: logical AND. It's not right. It will temporarily do.
 
-	uint16_t output = MaxWaveformValue;
+	for(std::size_t c = 0; c < length; c++) {
+		uint16_t output = MaxWaveformValue;
+
+		if constexpr (bool(waveform_bits & 4))	output &= pulse_output(phases[c]);
+		if constexpr (bool(waveform_bits & 2))	output &= Oscillator::sawtooth_output(phases[c]);
+		if constexpr (bool(waveform_bits & 1))	output &= triangle_output(phases[c], prior);
+		if constexpr (bool(waveform_bits & 8))	output &= NoiseGenerator::output(noises[c]);
 
-	if(pulse())		output &= pulse_output();
-	if(sawtooth())	output &= oscillator.sawtooth_output();
-	if(triangle())	output &= triangle_output(prior);
-	if(noise())		output &= noise_generator.output();
+		target[c] = output;
+	}
+}
 
-	return (output * adsr.envelope) / 255;
+void Voice::waveforms(
+	uint16_t *const target,
+	const uint32_t *const phases,
+	const uint32_t *const noises,
+	const std::size_t length,
+	const Voice &prior
+) const {
+	// Select a loop with the enabled waveforms fixed, based on control bits 4–7.
+	switch(control.get() >> 4) {
+#define Waveforms(x)	case x: waveforms<x>(target, phases, noises, length, prior);	break;
+		Waveforms(0);	Waveforms(1);	Waveforms(2);	Waveforms(3);
+		Waveforms(4);	Waveforms(5);	Waveforms(6);	Waveforms(7);
+		Waveforms(8);	Waveforms(9);	Waveforms(10);	Waveforms(11);
+		Waveforms(12);	Waveforms(13);	Waveforms(14);	Waveforms(15);
+#undef Waveforms
+	}
 }
 
 // MARK: - Wave generation
@@ -373,55 +436,100 @@ bool SID::is_zero_level() const {
 
 template <Outputs::Speaker::Action action>
 void SID::apply_samples(const std::size_t number_of_samples, Outputs::Speaker::MonoSample *const target) {
-	for(std::size_t c = 0; c < number_of_samples; c++) {
-		// Advance phase.
-		voices_[0].update();
-		voices_[1].update();
-		voices_[2].update();
-
-		// Apply hard synchronisations.
-		voices_[0].synchronise(voices_[2]);
-		voices_[1].synchronise(voices_[0]);
-		voices_[2].synchronise(voices_[1]);
-
-		// Construct filtered and unfiltered output.
-		const uint16_t outputs[3] = {
-			voices_[0].output(voices_[2]),
-			voices_[1].output(voices_[0]),
-			voices_[2].output(voices_[1]),
-		};
+	// Register writes are applied only in between calls to apply_samples, so filter routing
+	// is fixed for the duration of this call. Capture it as masks.
+	const uint16_t filter_masks[3] = {
+		uint16_t(filter_channels_.bit<0>() ? 0xffff : 0x0000),
+		uint16_t(filter_channels_.bit<1>() ? 0xffff : 0x0000),
+		uint16_t(filter_channels_.bit<2>() ? 0xffff : 0x0000),
+	};
+	const uint16_t direct_masks[3] = {
+		uint16_t(~filter_masks[0]),
+		uint16_t(~filter_masks[1]),
+		uint16_t(voice3_disable_ ? 0x0000 : ~filter_masks[2]),
+	};
+
+	// Work in blocks: first run all oscillators for the whole block, then produce waveforms from
+	// the captured oscillator states, then apply envelopes, then mix and filter. Envelopes are
+	// independent of the oscillators and change only occasionally, so are advanced in runs;
+	// the other steps are each a tight loop with any decisions made outside it.
+	for(std::size_t offset = 0; offset < number_of_samples; offset += BlockSize) {
+		const std::size_t length = std::min(BlockSize, number_of_samples - offset);
+
+		uint32_t phases[3][BlockSize];
+		uint32_t noises[3][BlockSize];
+		for(std::size_t c = 0; c < length; c++) {
+			// Advance phase.
+			voices_[0].update();
+			voices_[1].update();
+			voices_[2].update();
+
+			// Apply hard synchronisations.
+			voices_[0].synchronise(voices_[2]);
+			voices_[1].synchronise(voices_[0]);
+			voices_[2].synchronise(voices_[1]);
+
+			// Capture state.
+			for(int voice = 0; voice < 3; voice++) {
+				phases[voice][c] = voices_[voice].oscillator.phase;
+				noises[voice][c] = voices_[voice].noise_generator.noise;
+			}
+		}
 
-		const uint16_t direct_sample =
-			(filter_channels_.bit<0>() ? 0 : outputs[0]) +
-			(filter_channels_.bit<1>() ? 0 : outputs[1]) +
-			(filter_channels_.bit<2>() || voice3_disable_ ? 0 : outputs[2]);
+		// Generate waveforms.
+		uint16_t outputs[3][BlockSize];
+		voices_[0].waveforms(outputs[0], phases[0], noises[0], length, voices_[2]);
+		voices_[1].waveforms(outputs[1], phases[1], noises[1], length, voices_[0]);
+		voices_[2].waveforms(outputs[2], phases[2], noises[2], length, voices_[1]);
+
+		// Apply envelopes.
+		for(int voice = 0; voice < 3; voice++) {
+			uint8_t envelope[BlockSize];
+			voices_[voice].adsr.update(envelope, length);
+			for(std::size_t c = 0; c < length; c++) {
+				outputs[voice][c] = uint16_t((outputs[voice][c] * envelope[c]) / 255);
+			}
+		}
 
-		const int16_t filtered_sample =
-			filter_.apply(
-				(filter_channels_.bit<0>() ? outputs[0] : 0) +
-				(filter_channels_.bit<1>() ? outputs[1] : 0) +
-				(filter_channels_.bit<2>() ? outputs[2] : 0)
+		// Split into direct and filtered output.
+		uint16_t direct_samples[BlockSize];
+		int16_t filter_inputs[BlockSize];
+		for(std::size_t c = 0; c < length; c++) {
+			direct_samples[c] = uint16_t(
+				(outputs[0][c] & direct_masks[0]) +
+				(outputs[1][c] & direct_masks[1]) +
+				(outputs[2][c] & direct_masks[2])
+			);
+			filter_inputs[c] = int16_t(
+				(outputs[0][c] & filter_masks[0]) +
+				(outputs[1][c] & filter_masks[1]) +
+				(outputs[2][c] & filter_masks[2])
 			);
+		}
 
-		// Sum, apply volume and output.
-		const auto sample = output_filter_.apply(int16_t(
-			(
-				volume_ * (
-					direct_sample +
-					filtered_sample
-						- 227	// DC offset.
-				)
-				- 88732
-			) / 3
-		));
-		// Maximum range of above: 15 * (4095 * 3 - 227) = [-3405, 180870]
-		// So subtracting 88732 will move to the centre of the range, and 3 is the smallest
-		// integer that avoids clipping.
-
-		Outputs::Speaker::apply<action>(
-			target[c],
-			Outputs::Speaker::MonoSample((sample * range_) >> 16)
-		);
+		for(std::size_t c = 0; c < length; c++) {
+			const int16_t filtered_sample = filter_.apply(filter_inputs[c]);
+
+			// Sum, apply volume and output.
+			const auto sample = output_filter_.apply(int16_t(
+				(
+					volume_ * (
+						direct_samples[c] +
+						filtered_sample
+							- 227	// DC offset.
+					)
+					- 88732
+				) / 3
+			));
+			// Maximum range of above: 15 * (4095 * 3 - 227) = [-3405, 180870]
+			// So subtracting 88732 will move to the centre of the range, and 3 is the smallest
+			// integer that avoids clipping.
+
+			Outputs::Speaker::apply<action>(
+				target[offset + c],
+				Outputs::Speaker::MonoSample((sample * range_) >> 16)
+			);
+		}
 	}
 }
 
@@ -39,6 +39,7 @@ struct Voice {
 		bool did_raise_b23() const;
 		bool did_raise_b19() const;
 		uint16_t sawtooth_output() const;
+		static uint16_t sawtooth_output(uint32_t phase);
 	} oscillator;
 	struct ADSR {
 		// Programmer inputs.
@@ -57,16 +58,23 @@ struct Voice {
 		Numeric::SizedInt<15> rate_counter;
 		Numeric::SizedInt<15> rate_counter_target;
 
-		uint8_t exponential_counter;
-		uint8_t envelope;
+		uint8_t exponential_counter = 0;
+		uint8_t envelope = 0;
 
 		void set_phase(const Phase);
+
+		/// Advances the envelope by @c length samples, storing its level after each in @c levels.
+		void update(uint8_t *levels, std::size_t length);
+
+	private:
+		void tick();
 	} adsr;
 	struct NoiseGenerator {
 		static constexpr uint32_t NoiseReload = 0x7'ffff;
 		uint32_t noise = NoiseReload;
 
 		uint16_t output() const;
+		static uint16_t output(uint32_t noise);
 		void update(const bool test);
 	} noise_generator;
 
@@ -75,6 +83,16 @@ struct Voice {
 	void synchronise(const Voice &prior);
 	uint16_t output(const Voice &prior) const;
 
+	/// Writes @c length samples of this voice's unenveloped waveform to @c target, given the
+	/// oscillator phase and noise generator state for each of those samples.
+	void waveforms(
+		uint16_t *target,
+		const uint32_t *phases,
+		const uint32_t *noises,
+		std::size_t length,
+		const Voice &prior
+	) const;
+
 private:
 	Numeric::SizedInt<8> control;
 	bool noise() const;
@@ -86,8 +104,11 @@ private:
 	bool sync() const;
 	bool gate() const;
 
-	uint16_t pulse_output() const;
-	uint16_t triangle_output(const Voice &prior) const;
+	uint16_t pulse_output(uint32_t phase) const;
+	uint16_t triangle_output(uint32_t phase, const Voice &prior) const;
+
+	template <int waveform_bits>
+	void waveforms(uint16_t *, const uint32_t *, const uint32_t *, std::size_t, const Voice &) const;
 };
 
 class SID: public Outputs::Speaker::BufferSource<SID, false> {
@@ -108,7 +129,10 @@ private:
 	Concurrency::AsyncTaskQueue<false> &audio_queue_;
 	Voice voices_[3];
 
-	uint8_t last_write_;
+	/// The number of samples for which voices are advanced before mixing and filtering.
+	static constexpr std::size_t BlockSize = 128;
+
+	uint8_t last_write_ = 0;
 
 	int16_t range_ = 0;
 	uint8_t volume_ = 0;
@@ -118,7 +142,7 @@ private:
 	Numeric::SizedInt<4> filter_resonance_;
 	Numeric::SizedInt<4> filter_channels_;
 	Numeric::SizedInt<3> filter_mode_;
-	bool voice3_disable_;
+	bool voice3_disable_ = false;
 	void update_filter();
 
 	SignalProcessing::BiquadFilter output_filter_;
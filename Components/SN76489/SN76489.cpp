@@ -17,7 +17,7 @@ SN76489::SN76489(
 	const Personality personality,
 	Concurrency::AsyncTaskQueue<false> &task_queue,
 	const int additional_divider
-) : task_queue_(task_queue) {
+) : writes_(*this, task_queue) {
 	set_sample_volume_range(0);
 
 	switch(personality) {
@@ -53,41 +53,43 @@ void SN76489::set_sample_volume_range(const std::int16_t range) {
 }
 
 void SN76489::write(const uint8_t value) {
-	task_queue_.enqueue([value, this] () {
-		if(value & 0x80) {
-			active_register_ = value;
-		}
+	writes_.push(value);
+}
+
+void SN76489::apply(const uint8_t value) {
+	if(value & 0x80) {
+		active_register_ = value;
+	}
 
-		const int channel = (active_register_ >> 5)&3;
-		if(active_register_ & 0x10) {
-			// latch for volume
-			channels_[channel].volume = value & 0xf;
-			evaluate_output_volume();
+	const int channel = (active_register_ >> 5)&3;
+	if(active_register_ & 0x10) {
+		// latch for volume
+		channels_[channel].volume = value & 0xf;
+		evaluate_output_volume();
+	} else {
+		// latch for tone/data
+		if(channel < 3) {
+			if(value & 0x80) {
+				channels_[channel].divider = (channels_[channel].divider & ~0xf) | (value & 0xf);
+			} else {
+				channels_[channel].divider = uint16_t((channels_[channel].divider & 0xf) | ((value & 0x3f) << 4));
+			}
 		} else {
-			// latch for tone/data
-			if(channel < 3) {
-				if(value & 0x80) {
-					channels_[channel].divider = (channels_[channel].divider & ~0xf) | (value & 0xf);
-				} else {
-					channels_[channel].divider = uint16_t((channels_[channel].divider & 0xf) | ((value & 0x3f) << 4));
-				}
+			// writes to the noise register always reset the shifter
+			noise_shifter_ = shifter_is_16bit_ ? 0x8000 : 0x4000;
+
+			if(value & 4) {
+				noise_mode_ = shifter_is_16bit_ ? Noise16 : Noise15;
 			} else {
-				// writes to the noise register always reset the shifter
-				noise_shifter_ = shifter_is_16bit_ ? 0x8000 : 0x4000;
-
-				if(value & 4) {
-					noise_mode_ = shifter_is_16bit_ ? Noise16 : Noise15;
-				} else {
-					noise_mode_ = shifter_is_16bit_ ? Periodic16 : Periodic15;
-				}
-
-				channels_[3].divider = uint16_t(0x10 << (value & 3));
-				// Special case: if these bits are both set, the noise channel should track channel 2,
-				// which is marked with a divider of 0xffff.
-				if(channels_[3].divider == 0x80) channels_[3].divider = 0xffff;
+				noise_mode_ = shifter_is_16bit_ ? Periodic16 : Periodic15;
 			}
+
+			channels_[3].divider = uint16_t(0x10 << (value & 3));
+			// Special case: if these bits are both set, the noise channel should track channel 2,
+			// which is marked with a divider of 0xffff.
+			if(channels_[3].divider == 0x80) channels_[3].divider = 0xffff;
 		}
-	});
+	}
 }
 
 bool SN76489::is_zero_level() const {
@@ -109,6 +111,13 @@ void SN76489::evaluate_output_volume() {
 
 template <Outputs::Speaker::Action action>
 void SN76489::apply_samples(const std::size_t number_of_samples, Outputs::Speaker::MonoSample *const target) {
+	writes_.generate(number_of_samples, target, [&](const std::size_t length, Outputs::Speaker::MonoSample *const segment) {
+		generate_samples<action>(length, segment);
+	});
+}
+
+template <Outputs::Speaker::Action action>
+void SN76489::generate_samples(const std::size_t number_of_samples, Outputs::Speaker::MonoSample *const target) {
 	std::size_t c = 0;
 	while((master_divider_& (master_divider_period_ - 1)) && c < number_of_samples) {
 		Outputs::Speaker::apply<action>(target[c], output_volume_);
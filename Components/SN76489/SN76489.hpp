@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Outputs/Speaker/Implementation/BufferSource.hpp"
+#include "Outputs/Speaker/Implementation/RegisterWriteLog.hpp"
 #include "Concurrency/AsyncTaskQueue.hpp"
 
 namespace TI {
@@ -32,16 +33,23 @@ public:
 	void apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target);
 	bool is_zero_level() const;
 	void set_sample_volume_range(std::int16_t range);
+	void will_run_for(const Cycles cycles) {	writes_.will_run_for(cycles);	}
+	void did_run_for(const Cycles cycles) {		writes_.did_run_for(cycles);	}
 
 private:
+	friend Outputs::Speaker::RegisterWriteLog<SN76489, uint8_t>;
+	Outputs::Speaker::RegisterWriteLog<SN76489, uint8_t> writes_;
+	void apply(uint8_t);
+
+	template <Outputs::Speaker::Action action>
+	void generate_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target);
+
 	int master_divider_ = 0;
 	int master_divider_period_ = 16;
 	int16_t output_volume_ = 0;
 	void evaluate_output_volume();
 	int volumes_[16];
 
-	Concurrency::AsyncTaskQueue<false> &task_queue_;
-
 	struct ToneChannel {
 		// Programmatically-set state; updated by the processor.
 		uint16_t divider = 0;
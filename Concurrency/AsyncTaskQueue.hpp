@@ -15,6 +15,7 @@
 #include <thread>
 #include <vector>
 
+#include "ClockReceiver/Profiler.hpp"
 #include "ClockReceiver/TimeTypes.hpp"
 
 namespace Concurrency {
@@ -90,19 +91,22 @@ public:
 	/// If this TaskQueue has a @c Performer then the action will be performed
 	/// on the same thread as the performer, after the performer has been updated
 	/// to 'now'.
+	///
+	/// If this TaskQueue is currently disabled, the action is discarded.
 	template <typename FuncT>
 	requires std::invocable<FuncT>
 	void enqueue(FuncT &&action) {
-		const std::lock_guard guard(condition_mutex_);
-		actions_.emplace_back(std::forward<FuncT>(action));
+		if(!is_enabled_) return;
+		push(std::forward<FuncT>(action));
+	}
 
-		if constexpr (perform_automatically) {
-			condition_.notify_one();
-		} else {
-			if(actions_.size() >= MaximumEnqueueActions) {
-				condition_.notify_one();
-			}
-		}
+	/// Enables or disables this queue; while disabled, newly-enqueued actions are discarded.
+	/// This allows an owner to perform work speculatively, then roll it back, without any of
+	/// the speculative actions being performed.
+	///
+	/// This should be called only from the thread that enqueues actions.
+	void set_is_enabled(const bool is_enabled) {
+		is_enabled_ = is_enabled;
 	}
 
 	/// @returns The number of items currently enqueued.
@@ -128,7 +132,7 @@ public:
 	void stop() {
 		if(thread_.joinable()) {
 			should_quit_.test_and_set();
-			enqueue([] {});
+			push([] {});
 			if constexpr (!perform_automatically) {
 				perform();
 			}
@@ -152,7 +156,7 @@ public:
 		bool has_run = false;
 		std::unique_lock lock(flush_mutex);
 
-		enqueue([&flush_mutex, &flush_condition, &has_run] () {
+		push([&flush_mutex, &flush_condition, &has_run] () {
 			std::unique_lock inner_lock(flush_mutex);
 			has_run = true;
 			flush_condition.notify_one();
@@ -171,7 +175,7 @@ public:
 	void spin_flush() {
 		std::atomic_flag has_run{};
 
-		enqueue([&has_run] () {
+		push([&has_run] () {
 			has_run.test_and_set(std::memory_order::release);
 		});
 
@@ -189,6 +193,20 @@ public:
 private:
 	static constexpr size_t MaximumEnqueueActions = 1000;
 
+	template <typename FuncT>
+	void push(FuncT &&action) {
+		const std::lock_guard guard(condition_mutex_);
+		actions_.emplace_back(std::forward<FuncT>(action));
+
+		if constexpr (perform_automatically) {
+			condition_.notify_one();
+		} else {
+			if(actions_.size() >= MaximumEnqueueActions) {
+				condition_.notify_one();
+			}
+		}
+	}
+
 	void start_impl() {
 		thread_ = std::thread{
 			[this] {
@@ -209,6 +227,7 @@ private:
 
 					// Perform the actions and destroy them.
 					for(const auto &action: actions) {
+						const Profiler::Scope scope(Profiler::Component::Queue);
 						action();
 					}
 					actions.clear();
@@ -221,6 +240,7 @@ private:
 	// increasing their latency, if the emulation thread falls behind.
 	using ActionVector = std::vector<std::function<void(void)>>;
 	ActionVector actions_;
+	bool is_enabled_ = true;
 
 	// Necessary synchronisation parts.
 	std::atomic_flag should_quit_;
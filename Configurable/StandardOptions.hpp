@@ -52,6 +52,20 @@ protected:
 	}
 };
 
+/// Rotates disks directly to the next matching sector ID rather than waiting for it to come around.
+/// This changes disk timing that copy-protected titles may measure, so machines should default it to off.
+static constexpr auto FastSectorSearchOptionName = "accelerate_disk_sector_searches";
+template <typename Owner> class FastSectorSearch {
+public:
+	bool fast_sector_search;
+	FastSectorSearch(const bool fast_sector_search) noexcept : fast_sector_search(fast_sector_search) {}
+
+protected:
+	void declare_fast_sector_search_option() {
+		static_cast<Owner *>(this)->declare(&fast_sector_search, FastSectorSearchOptionName);
+	}
+};
+
 static constexpr auto QuickBootOptionName = "shorten_machine_startup";
 template <typename Owner> class QuickBoot {
 public:
@@ -8,19 +8,24 @@
 
 #include "Decoder.hpp"
 
+#include <algorithm>
+#include <vector>
+
 using namespace InstructionSet::PowerPC;
 
 namespace {
 
-template <Model model, bool validate_reserved_bits, Operation operation>
-Instruction instruction(const uint32_t opcode, const bool is_supervisor = false) {
-	// If validation isn't required, there's nothing to do here.
-	if constexpr (!validate_reserved_bits) {
-		return Instruction(operation, opcode, is_supervisor);
-	}
-
-	// Otherwise, validation depends on operation
-	// (and, in principle, processor model).
+/// Describes the reserved bits of an encoding: an opcode is valid only if
+/// `(opcode & mask) == value`.
+struct ReservedBits {
+	uint32_t mask = 0;
+	uint32_t value = 0;
+};
+
+/// @returns the reserved bits for @c operation.
+template <Model>
+constexpr ReservedBits reserved_bits(const Operation operation) {
+	// Validation depends on operation (and, in principle, processor model).
 	switch(operation) {
 		case Operation::absx:		case Operation::clcs:
 		case Operation::nabsx:
@@ -31,21 +36,17 @@ Instruction instruction(const uint32_t opcode, const bool is_supervisor = false)
 		case Operation::fmulx:		case Operation::fmulsx:
 		case Operation::negx:
 		case Operation::subfmex:	case Operation::subfzex:
-			if(opcode & 0b000000'00000'00000'11111'0000000000'0) return Instruction(opcode);
-		break;
+			return {0b000000'00000'00000'11111'0000000000'0, 0};
 
 		case Operation::cmp:		case Operation::cmpl:
-			if(opcode & 0b000000'00010'00000'00000'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00010'00000'00000'0000000000'1, 0};
 
 		case Operation::cmpi:		case Operation::cmpli:
-			if(opcode & 0b000000'00010'00000'00000'0000000000'0) return Instruction(opcode);
-		break;
+			return {0b000000'00010'00000'00000'0000000000'0, 0};
 
 		case Operation::dcbf:		case Operation::dcbi:		case Operation::dcbst:
 		case Operation::dcbt:		case Operation::dcbtst:		case Operation::dcbz:
-			if(opcode & 0b000000'11111'00000'00000'0000000000'0) return Instruction(opcode);
-		break;
+			return {0b000000'11111'00000'00000'0000000000'0, 0};
 
 		case Operation::crand:		case Operation::crandc:		case Operation::creqv:
 		case Operation::crnand:		case Operation::crnor:		case Operation::cror:
@@ -74,35 +75,29 @@ Instruction instruction(const uint32_t opcode, const bool is_supervisor = false)
 		case Operation::stwbrx:
 		case Operation::stwux:		case Operation::stwx:
 		case Operation::td:			case Operation::tw:
-			if(opcode & 0b000000'00000'00000'00000'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00000'00000'00000'0000000000'1, 0};
 
 		case Operation::fabsx:		case Operation::fcfidx:
 		case Operation::fctidx:		case Operation::fctidzx:
 		case Operation::fctiwx:		case Operation::fctiwzx:
 		case Operation::fmrx:		case Operation::fnabsx:
 		case Operation::fnegx:		case Operation::frspx:
-			if(opcode & 0b000000'00000'11111'00000'0000000000'0) return Instruction(opcode);
-		break;
+			return {0b000000'00000'11111'00000'0000000000'0, 0};
 
 		case Operation::faddx:		case Operation::faddsx:
 		case Operation::fdivx:		case Operation::fdivsx:
 		case Operation::fsubx:		case Operation::fsubsx:
-			if(opcode & 0b000000'00000'00000'00000'1111100000'0) return Instruction(opcode);
-		break;
+			return {0b000000'00000'00000'00000'1111100000'0, 0};
 
 		case Operation::fcmpo:		case Operation::fcmpu:
-			if(opcode & 0b000000'00011'00000'00000'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00011'00000'00000'0000000000'1, 0};
 
 		case Operation::fresx:		case Operation::frsqrtex:
 		case Operation::fsqrtx:		case Operation::fsqrtsx:
-			if(opcode & 0b000000'00000'11111'00000'1111100000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00000'11111'00000'1111100000'1, 0};
 
 		case Operation::icbi:
-			if(opcode & 0b000000'11111'00000'00000'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'11111'00000'00000'0000000000'1, 0};
 
 		case Operation::eieio:
 		case Operation::isync:
@@ -111,71 +106,57 @@ Instruction instruction(const uint32_t opcode, const bool is_supervisor = false)
 		case Operation::sync:
 		case Operation::tlbia:
 		case Operation::tlbsync:
-			if(opcode & 0b000000'11111'11111'11111'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'11111'11111'11111'0000000000'1, 0};
 
 		case Operation::mcrf:		case Operation::mcrfs:
-			if(opcode & 0b000000'00011'00011'11111'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00011'00011'11111'0000000000'1, 0};
 
 		case Operation::mcrxr:
-			if(opcode & 0b000000'00011'11111'11111'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00011'11111'11111'0000000000'1, 0};
 
 		case Operation::mfcr:
 		case Operation::mfmsr:
 		case Operation::mtmsr:
-			if(opcode & 0b000000'00000'11111'11111'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00000'11111'11111'0000000000'1, 0};
 
 		case Operation::mffsx:
 		case Operation::mtfsb0x:
 		case Operation::mtfsb1x:
-			if(opcode & 0b000000'00000'11111'11111'0000000000'0) return Instruction(opcode);
-		break;
+			return {0b000000'00000'11111'11111'0000000000'0, 0};
 
 		case Operation::mtfsfx:
-			if(opcode & 0b000000'10000'00001'00000'0000000000'0) return Instruction(opcode);
-		break;
+			return {0b000000'10000'00001'00000'0000000000'0, 0};
 
 		case Operation::mtfsfix:
-			if(opcode & 0b000000'00011'11111'00001'0000000000'0) return Instruction(opcode);
-		break;
+			return {0b000000'00011'11111'00001'0000000000'0, 0};
 
 		case Operation::mtsr:
-			if(opcode & 0b000000'00000'10000'11111'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00000'10000'11111'0000000000'1, 0};
 
 		case Operation::mtsrin:		case Operation::mfsrin:
-			if(opcode & 0b000000'00000'11111'00000'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00000'11111'00000'0000000000'1, 0};
 
 		case Operation::mfsr:
-			if(opcode & 0b000000'00000'10000'11111'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00000'10000'11111'0000000000'1, 0};
 
 		case Operation::mtcrf:
-			if(opcode & 0b000000'00000'10000'00001'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'00000'10000'00001'0000000000'1, 0};
 
 		case Operation::mulhdx:		case Operation::mulhdux:
 		case Operation::mulhwx:		case Operation::mulhwux:
-			if(opcode & 0b000000'00000'00000'00000'1000000000'0) return Instruction(opcode);
-		break;
+			return {0b000000'00000'00000'00000'1000000000'0, 0};
 
 		case Operation::sc:
-			if(opcode & 0b000000'11111'11111'11111'1111111110'1) return Instruction(opcode);
-		break;
+			return {0b000000'11111'11111'11111'1111111110'1, 0};
 
 		case Operation::slbie:
 		case Operation::tlbie:
-			if(opcode & 0b000000'11111'11111'00000'0000000000'1) return Instruction(opcode);
-		break;
+			return {0b000000'11111'11111'00000'0000000000'1, 0};
 
 		case Operation::stwcx_:
-			if(!(opcode & 0b000000'00000'00000'00000'0000000000'1)) return Instruction(opcode);
-		break;
+			return {0b000000'00000'00000'00000'0000000000'1, 0b000000'00000'00000'00000'0000000000'1};
 
+		case Operation::Undefined:
 		case Operation::divx:		case Operation::divsx:
 		case Operation::dozx:		case Operation::dozi:
 		case Operation::lscbxx:
@@ -238,13 +219,15 @@ Instruction instruction(const uint32_t opcode, const bool is_supervisor = false)
 		break;
 	}
 
-	return Instruction(operation, opcode, is_supervisor);
-}
-
+	return {};
 }
 
-template <Model model, bool validate_reserved_bits>
-Instruction Decoder<model, validate_reserved_bits>::decode(const uint32_t opcode) {
+/// Identifies the operation, and whether it is supervisor-only, for @c opcode by
+/// working through the encoding by successive masking; performs no validation of reserved bits.
+///
+/// This is used only to populate @c DecodeTable.
+template <Model model>
+Instruction decode_by_field(const uint32_t opcode) {
 	// Quick bluffer's guide to PowerPC instruction encoding:
 	//
 	// There is a six-bit field at the very top of the instruction.
@@ -264,16 +247,16 @@ Instruction Decoder<model, validate_reserved_bits>::decode(const uint32_t opcode
 	// currently check the value of reserved bits. That may need to change
 	// if/when I add support for extended instruction sets.
 
-#define Bind(mask, operation)				case mask: return instruction<model, validate_reserved_bits, Operation::operation>(opcode);
-#define BindSupervisor(mask, operation)		case mask: return instruction<model, validate_reserved_bits, Operation::operation>(opcode, true);
+#define Bind(mask, operation)				case mask: return Instruction(Operation::operation, opcode);
+#define BindSupervisor(mask, operation)		case mask: return Instruction(Operation::operation, opcode, true);
 #define BindConditional(condition, mask, operation)	\
 	case mask: \
-		if(condition(model)) return instruction<model, validate_reserved_bits, Operation::operation>(opcode);	\
-	return instruction<model, validate_reserved_bits, Operation::operation>(opcode);
+		if(condition(model)) return Instruction(Operation::operation, opcode);	\
+	return Instruction(Operation::operation, opcode);
 #define BindSupervisorConditional(condition, mask, operation)	\
 	case mask: \
-		if(condition(model)) return instruction<model, validate_reserved_bits, Operation::operation>(opcode, true);	\
-	return instruction<model, validate_reserved_bits, Operation::operation>(opcode);
+		if(condition(model)) return Instruction(Operation::operation, opcode, true);	\
+	return Instruction(Operation::operation, opcode);
 
 #define Six(x)			(unsigned(x) << 26)
 #define SixTen(x, y)	(Six(x) | ((y) << 1))
@@ -296,7 +279,7 @@ Instruction Decoder<model, validate_reserved_bits>::decode(const uint32_t opcode
 				case 0: case 1: case 2: case 3: case 4: case 5:
 				case 8: case 9: case 10: case 11: case 12: case 13:
 				case 16: case 17: case 18: case 19: case 20:
-				return instruction<model, validate_reserved_bits, Operation::bcx>(opcode);
+				return Instruction(Operation::bcx, opcode);
 
 				default: return Instruction(opcode);
 			}
@@ -567,13 +550,13 @@ Instruction Decoder<model, validate_reserved_bits>::decode(const uint32_t opcode
 		switch(opcode & 0b111111'00000'00000'00000'000000'111'00) {
 			default: break;
 			case 0b011110'00000'00000'00000'000000'000'00:
-				return instruction<model, validate_reserved_bits, Operation::rldiclx>(opcode);
+				return Instruction(Operation::rldiclx, opcode);
 			case 0b011110'00000'00000'00000'000000'001'00:
-				return instruction<model, validate_reserved_bits, Operation::rldicrx>(opcode);
+				return Instruction(Operation::rldicrx, opcode);
 			case 0b011110'00000'00000'00000'000000'010'00:
-				return instruction<model, validate_reserved_bits, Operation::rldicx>(opcode);
+				return Instruction(Operation::rldicx, opcode);
 			case 0b011110'00000'00000'00000'000000'011'00:
-				return instruction<model, validate_reserved_bits, Operation::rldimix>(opcode);
+				return Instruction(Operation::rldimix, opcode);
 		}
 	}
 
@@ -581,9 +564,9 @@ Instruction Decoder<model, validate_reserved_bits>::decode(const uint32_t opcode
 	switch(opcode & 0b111111'0000'0000'0000'0000'111111111'1) {
 		default: break;
 		case 0b011111'0000'0000'0000'0000'010010110'1:
-			return instruction<model, validate_reserved_bits, Operation::stwcx_>(opcode);
+			return Instruction(Operation::stwcx_, opcode);
 		case 0b011111'0000'0000'0000'0000'011010110'1:
-			if(is64bit(model)) return instruction<model, validate_reserved_bits, Operation::stdcx_>(opcode);
+			if(is64bit(model)) return Instruction(Operation::stdcx_, opcode);
 		return Instruction(opcode);
 	}
 
@@ -592,21 +575,21 @@ Instruction Decoder<model, validate_reserved_bits>::decode(const uint32_t opcode
 		switch(opcode & 0b111111'00'00000000'00000000'000000'11) {
 			default: break;
 			case 0b111010'00'00000000'00000000'000000'00:
-				return instruction<model, validate_reserved_bits, Operation::ld>(opcode);
+				return Instruction(Operation::ld, opcode);
 			case 0b111010'00'00000000'00000000'000000'01:
-				return instruction<model, validate_reserved_bits, Operation::ldu>(opcode);
+				return Instruction(Operation::ldu, opcode);
 			case 0b111010'00'00000000'00000000'000000'10:
-				return instruction<model, validate_reserved_bits, Operation::lwa>(opcode);
+				return Instruction(Operation::lwa, opcode);
 			case 0b111110'00'00000000'00000000'000000'00:
-				return instruction<model, validate_reserved_bits, Operation::std>(opcode);
+				return Instruction(Operation::std, opcode);
 			case 0b111110'00'00000000'00000000'000000'01:
-				return instruction<model, validate_reserved_bits, Operation::stdu>(opcode);
+				return Instruction(Operation::stdu, opcode);
 		}
 	}
 
 	// sc
 	if((opcode & 0b111111'00'00000000'00000000'000000'1'0) == 0b010001'00'00000000'00000000'000000'1'0) {
-		return instruction<model, validate_reserved_bits, Operation::sc>(opcode);
+		return Instruction(Operation::sc, opcode);
 	}
 
 #undef Six
@@ -618,6 +601,95 @@ Instruction Decoder<model, validate_reserved_bits>::decode(const uint32_t opcode
 	return Instruction(opcode);
 }
 
+/*!
+	Provides a two-level lookup from opcode to operation: the primary opcode,
+	i.e. the top six bits, selects a slice of @c entries plus the field of the opcode
+	that indexes within it.
+
+	For most primary opcodes that field is empty because the primary
+	opcode alone is sufficient. Otherwise it is the low eleven bits,
+	which include the extended opcode and any other flags that participate
+	in decoding, except for bcx for which the BO field is inspected.
+*/
+template <Model model>
+struct DecodeTable {
+	struct Primary {
+		uint32_t base = 0;
+		uint32_t mask = 0;
+		int shift = 0;
+	};
+	struct Entry {
+		Operation operation = Operation::Undefined;
+		bool is_supervisor = false;
+	};
+
+	Primary primaries[64];
+	std::vector<Entry> entries;
+	ReservedBits reserved[256];
+
+	DecodeTable() {
+		for(int c = 0; c < 256; c++) {
+			reserved[c] = reserved_bits<model>(Operation(c));
+		}
+
+		const auto append = [&](const uint32_t opcode) {
+			const auto instruction = decode_by_field<model>(opcode);
+			entries.push_back(Entry{instruction.operation, instruction.is_supervisor});
+		};
+
+		for(uint32_t c = 0; c < 64; c++) {
+			auto &primary = primaries[c];
+			primary.base = uint32_t(entries.size());
+
+			// bcx is the only operation that depends on anything other than
+			// the primary and extended opcode fields.
+			if(c == 0b010000) {
+				primary.shift = 21;
+				primary.mask = 0x1f;
+				for(uint32_t bo = 0; bo < 32; bo++) {
+					append((c << 26) | (bo << 21));
+				}
+				continue;
+			}
+
+			primary.mask = 0x7ff;
+			for(uint32_t extended = 0; extended < 2048; extended++) {
+				append((c << 26) | extended);
+			}
+
+			// If the primary opcode is sufficient, collapse to a single entry.
+			const auto first = entries.begin() + primary.base;
+			if(std::all_of(first, entries.end(), [&](const Entry &entry) {
+				return entry.operation == first->operation && entry.is_supervisor == first->is_supervisor;
+			})) {
+				primary.mask = 0;
+				entries.resize(primary.base + 1);
+			}
+		}
+	}
+
+	Entry lookup(const uint32_t opcode) const {
+		const auto &primary = primaries[opcode >> 26];
+		return entries[primary.base + ((opcode >> primary.shift) & primary.mask)];
+	}
+};
+
+}
+
+template <Model model, bool validate_reserved_bits>
+Instruction Decoder<model, validate_reserved_bits>::decode(const uint32_t opcode) {
+	static const DecodeTable<model> table;
+	const auto entry = table.lookup(opcode);
+
+	if constexpr (validate_reserved_bits) {
+		const auto &reserved = table.reserved[size_t(entry.operation)];
+		if((opcode & reserved.mask) != reserved.value) {
+			return Instruction(opcode);
+		}
+	}
+	return Instruction(entry.operation, opcode, entry.is_supervisor);
+}
+
 template struct InstructionSet::PowerPC::Decoder<InstructionSet::PowerPC::Model::MPC601, true>;
 template struct InstructionSet::PowerPC::Decoder<InstructionSet::PowerPC::Model::MPC603, true>;
 template struct InstructionSet::PowerPC::Decoder<InstructionSet::PowerPC::Model::MPC620, true>;
@@ -42,6 +42,9 @@ constexpr bool is601(const Model model) {
 	reserved bits are 0 or 1 as required and produce an invalid opcode if not.
 	Otherwise does no inspection of reserved bits.
 
+	Decoding is a two-level table lookup, with tables shared by all decoders of
+	the same model.
+
 	TODO: determine what specific models of PowerPC do re: reserved bits.
 */
 template <Model model, bool validate_reserved_bits = false> struct Decoder {
@@ -14,6 +14,105 @@
 
 using namespace InstructionSet::x86;
 
+namespace {
+
+// This table is fairly redundant due to the register ordering within
+// Source, but acts to improve readability and permit further Source
+// reordering in the future.
+constexpr Source reg_table[8] = {
+	Source::eAX,		Source::eCX,		Source::eDX,		Source::eBX,
+	Source::eSPorAH,	Source::eBPorCH,	Source::eSIorDH,	Source::eDIorBH,
+};
+
+// The fixed index+base pairs of 16-bit ModRegRM addressing.
+//
+// A base of eAX is meaningless, with the source type being the indicator
+// that it should be ignored. ScaleIndexBase can't store a base of Source::None.
+constexpr ScaleIndexBase rm_table[8] = {
+	ScaleIndexBase(0, Source::eSI, Source::eBX),
+	ScaleIndexBase(0, Source::eDI, Source::eBX),
+	ScaleIndexBase(0, Source::eSI, Source::eBP),
+	ScaleIndexBase(0, Source::eDI, Source::eBP),
+	ScaleIndexBase(0, Source::eSI, Source::eAX),
+	ScaleIndexBase(0, Source::eDI, Source::eAX),
+	ScaleIndexBase(0, Source::None, Source::eBP),
+	ScaleIndexBase(0, Source::eBX, Source::eAX),
+};
+
+}
+
+template <Model model>
+Decoder<model>::Decoder() {
+	build_descriptors();
+}
+
+template <Model model>
+void Decoder<model>::build_descriptors() {
+	// Probe a copy of this decoder, with the fast path disabled, for the outcome of each possible
+	// opcode if offered alone and with no preceding prefixes.
+	Decoder<model> probe = *this;
+	probe.descriptors_ = {};
+
+	for(int c = 0; c < 256; c++) {
+		const uint8_t opcode = uint8_t(c);
+		auto &descriptor = descriptors_[c];
+		descriptor = OpcodeDescriptor();
+
+		probe.reset_parsing();
+		const auto [size, instruction] = probe.decode(&opcode, 1);
+
+		if(size == 1) {
+			// Complete as soon as the opcode is encountered; this also catches opcodes
+			// that are undefined on this model.
+			descriptor.instruction = instruction;
+			descriptor.length = 1;
+			continue;
+		}
+
+		// Accept those opcodes that are followed by a ModRegRM byte that just picks a source and
+		// destination, other than those that are subject to further validation, provided that
+		// 16-bit addressing is in use.
+		if(
+			probe.phase_ == Phase::ModRegRM &&
+			probe.address_size_ == AddressSize::b16 &&
+			(
+				probe.modregrm_format_ == ModRegRMFormat::MemReg_Reg ||
+				probe.modregrm_format_ == ModRegRMFormat::Reg_MemReg
+			) &&
+			probe.operand_size_ == DataSize::None &&
+			probe.operation_ != Operation::BOUND &&
+			probe.operation_ != Operation::LES &&
+			probe.operation_ != Operation::LDS
+		) {
+			descriptor.operation = probe.operation_;
+			descriptor.operation_size = probe.operation_size_;
+			descriptor.modregrm = true;
+			descriptor.format = probe.modregrm_format_;
+			continue;
+		}
+
+		// Otherwise accept only those opcodes that proceed directly to collecting a displacement
+		// and/or operand, and which aren't subject to further validation upon completion.
+		if(
+			probe.phase_ != Phase::DisplacementOrOperand ||
+			probe.operation_ == Operation::JMPfar ||
+			probe.operation_ == Operation::CALLfar
+		) {
+			continue;
+		}
+
+		descriptor.operation = probe.operation_;
+		descriptor.source = probe.source_;
+		descriptor.destination = probe.destination_;
+		descriptor.operation_size = probe.operation_size_;
+		descriptor.displacement_size = probe.displacement_size_;
+		descriptor.operand_size = probe.operand_size_;
+		descriptor.sign_extend_displacement = probe.sign_extend_displacement_;
+		descriptor.sign_extend_operand = probe.sign_extend_operand_ && probe.operand_size_ != probe.data_size_;
+		descriptor.length = uint8_t(1 + byte_size(probe.displacement_size_) + byte_size(probe.operand_size_));
+	}
+}
+
 template <Model model>
 std::pair<int, typename Decoder<model>::InstructionT> Decoder<model>::decode(
 	const uint8_t *source,
@@ -33,6 +132,102 @@ std::pair<int, typename Decoder<model>::InstructionT> Decoder<model>::decode(
 	static constexpr bool is_32bit = instruction_type(model) == InstructionType::Bits32;
 	const uint8_t *const end = source + std::min(length, size_t(max_instruction_length - consumed_));
 
+	// MARK: - Fast path.
+
+	// If this is the start of a new instruction, and the opcode is one that needs no further
+	// decoding beyond collection of any displacement and operand, and the whole instruction is
+	// available then build it directly from its descriptor.
+	if(!consumed_ && length) {
+		const auto &descriptor = descriptors_[*source];
+		if(descriptor.length == 1) {
+			return std::make_pair(1, descriptor.instruction);
+		}
+
+		if(descriptor.modregrm && length >= 2) {
+			const uint8_t mod = source[1] >> 6;
+			const uint8_t reg = (source[1] >> 3) & 7;
+			const uint8_t rm = source[1] & 7;
+
+			Source memreg;
+			ScaleIndexBase sib;
+			DataSize displacement_size = DataSize::None;
+			if(mod == 3) {
+				memreg = reg_table[rm];
+			} else if(rm == 6 && mod == 0) {
+				displacement_size = DataSize::Word;
+				memreg = Source::DirectAddress;
+			} else {
+				constexpr DataSize sizes[] = {DataSize::None, DataSize::Byte, DataSize::Word};
+				displacement_size = sizes[mod];
+				sib = rm_table[rm];
+				memreg = (rm >= 4 && rm != 6) ? Source::IndirectNoBase : Source::Indirect;
+			}
+
+			const int instruction_length = 2 + int(byte_size(displacement_size));
+			if(length >= size_t(instruction_length)) {
+				int16_t displacement = 0;
+				switch(displacement_size) {
+					default: break;
+					case DataSize::Byte:	displacement = int8_t(source[2]);					break;
+					case DataSize::Word:	displacement = int16_t(source[2] | (source[3] << 8));	break;
+				}
+
+				const bool reg_is_source = descriptor.format == ModRegRMFormat::MemReg_Reg;
+				return std::make_pair(
+					instruction_length,
+					InstructionT(
+						descriptor.operation,
+						reg_is_source ? reg_table[reg] : memreg,
+						reg_is_source ? memreg : reg_table[reg],
+						sib,
+						false,
+						address_size_,
+						Source::None,
+						descriptor.operation_size,
+						static_cast<typename InstructionT::DisplacementT>(displacement),
+						0
+					)
+				);
+			}
+		}
+
+		if(descriptor.length && length >= descriptor.length) {
+			uint64_t inward_data = 0;
+			for(int c = descriptor.length - 1; c > 0; c--) {
+				inward_data = (inward_data << 8) | source[c];
+			}
+
+			const auto extend = [](const uint64_t value, const DataSize size, const bool sign_extend) -> uint32_t {
+				switch(size) {
+					default:				return 0;
+					case DataSize::Byte:	return sign_extend ? uint32_t(int8_t(value)) : uint8_t(value);
+					case DataSize::Word:	return sign_extend ? uint32_t(int16_t(value)) : uint16_t(value);
+					case DataSize::DWord:	return uint32_t(value);
+				}
+			};
+			const auto displacement =
+				extend(inward_data, descriptor.displacement_size, descriptor.sign_extend_displacement);
+			const auto operand =
+				extend(inward_data >> bit_size(descriptor.displacement_size), descriptor.operand_size, descriptor.sign_extend_operand);
+
+			return std::make_pair(
+				int(descriptor.length),
+				InstructionT(
+					descriptor.operation,
+					descriptor.source,
+					descriptor.destination,
+					ScaleIndexBase(),
+					false,
+					address_size_,
+					Source::None,
+					descriptor.operation_size,
+					static_cast<typename InstructionT::DisplacementT>(int32_t(displacement)),
+					static_cast<typename InstructionT::ImmediateT>(operand)
+				)
+			);
+		}
+	}
+
 	// MARK: - Prefixes (if present) and the opcode.
 
 #define Requires(x)		if constexpr (model != Model::x) return undefined();
@@ -653,13 +848,6 @@ std::pair<int, typename Decoder<model>::InstructionT> Decoder<model>::decode(
 
 		Source memreg;
 
-		// These tables are fairly redundant due to the register ordering within
-		// Source, but act to improve readability and permit further Source
-		// reordering in the future.
-		static constexpr Source reg_table[8] = {
-			Source::eAX,		Source::eCX,		Source::eDX,		Source::eBX,
-			Source::eSPorAH,	Source::eBPorCH,	Source::eSIorDH,	Source::eDIorBH,
-		};
 		static constexpr Source seg_table[6] = {
 			Source::ES,	Source::CS,	Source::SS,	Source::DS,	Source::FS,	Source::GS
 		};
@@ -701,20 +889,6 @@ std::pair<int, typename Decoder<model>::InstructionT> Decoder<model>::decode(
 			} else {
 				// Classic 16-bit decoding: mode picks a displacement size,
 				// and a few fixed index+base pairs are defined.
-				//
-				// A base of eAX is meaningless, with the source type being the indicator
-				// that it should be ignored. ScaleIndexBase can't store a base of Source::None.
-				static constexpr ScaleIndexBase rm_table[8] = {
-					ScaleIndexBase(0, Source::eSI, Source::eBX),
-					ScaleIndexBase(0, Source::eDI, Source::eBX),
-					ScaleIndexBase(0, Source::eSI, Source::eBP),
-					ScaleIndexBase(0, Source::eDI, Source::eBP),
-					ScaleIndexBase(0, Source::eSI, Source::eAX),
-					ScaleIndexBase(0, Source::eDI, Source::eAX),
-					ScaleIndexBase(0, Source::None, Source::eBP),
-					ScaleIndexBase(0, Source::eBX, Source::eAX),
-				};
-
 				sib_ = rm_table[rm];
 				memreg = (rm >= 4 && rm != 6) ? Source::IndirectNoBase : Source::Indirect;
 			}
@@ -1109,6 +1283,7 @@ template <Model model> void Decoder<model>::set_32bit_protected_mode(bool enable
 		default_address_size_ = address_size_ = AddressSize::b16;
 		default_data_size_ = data_size_ = DataSize::Word;
 	}
+	build_descriptors();
 }
 
 // Ensure all possible decoders are built.
@@ -11,6 +11,7 @@
 #include "Instruction.hpp"
 #include "Model.hpp"
 
+#include <array>
 #include <cstddef>
 #include <utility>
 
@@ -25,6 +26,8 @@ template <Model model> class Decoder {
 public:
 	using InstructionT = Instruction<instruction_type(model)>;
 
+	Decoder();
+
 	/*!
 		@returns an @c Instruction plus a size; a positive size indicates successful decoding of
 			an instruction that was that many bytes long in total; a negative size specifies the [negatived]
@@ -169,6 +172,36 @@ private:
 		MemRegBT_to_BTC,
 	} modregrm_format_ = ModRegRMFormat::MemReg_Reg;
 
+	/// Describes a single-byte opcode that needs no prefixes and is either complete other than for whatever
+	/// displacement and operand immediately follow it, or else is followed by a ModRegRM byte that merely
+	/// selects its source and destination.
+	struct OpcodeDescriptor {
+		/// The complete instruction, if this opcode has neither displacement nor operand.
+		InstructionT instruction;
+
+		Operation operation = Operation::Invalid;
+		Source source = Source::None;
+		Source destination = Source::None;
+		DataSize operation_size = DataSize::None;
+		DataSize displacement_size = DataSize::None;
+		DataSize operand_size = DataSize::None;
+		bool sign_extend_displacement = true;
+		bool sign_extend_operand = false;
+
+		/// Total instruction length, including the opcode, if implied by the opcode alone; 0 otherwise.
+		uint8_t length = 0;
+
+		/// If set then this opcode is followed by a ModRegRM byte in either the MemReg_Reg or Reg_MemReg @c format.
+		bool modregrm = false;
+		ModRegRMFormat format = ModRegRMFormat::MemReg_Reg;
+	};
+
+	/// Per-opcode descriptors for the fast path, which is used whenever an instruction begins with an
+	/// eligible opcode and is supplied in full. They're formed by probing the full decoder, so are
+	/// dependent on the default address and data sizes.
+	std::array<OpcodeDescriptor, 256> descriptors_;
+	void build_descriptors();
+
 	// Ephemeral decoding state.
 	Operation operation_ = Operation::Invalid;
 	int consumed_ = 0, operand_bytes_ = 0;
@@ -357,6 +390,7 @@ private:
 		const int size_mask
 	) {
 		const DataSize sizes[] = {DataSize::Byte, data_size_};
+		operation_ = Operation::Invalid;	// The operation is selected by the ModRegRM byte.
 		phase_ = Phase::ModRegRM;
 		modregrm_format_ = ModRegRMFormat::MemRegROL_to_SAR;
 		operation_size_ = sizes[size_mask];
@@ -1300,12 +1300,14 @@ private:
 	std::unique_ptr<Reflection::Struct> get_options() const final {
 		auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 		options->dynamic_crop = crtc_bus_handler_.dynamic_framing();
+		options->fast_sector_search = wd1770_.get_is_fast_sector_search();
 		return options;
 	}
 
 	void set_options(const std::unique_ptr<Reflection::Struct> &str) final {
 		const auto options = dynamic_cast<Options *>(str.get());
 		crtc_bus_handler_.set_dynamic_framing(options->dynamic_crop);
+		wd1770_.set_is_fast_sector_search(options->fast_sector_search);
 	}
 
 	// MARK: - Tube.
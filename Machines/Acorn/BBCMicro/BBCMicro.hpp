@@ -24,20 +24,24 @@ struct Machine {
 
 	class Options:
 		public Reflection::StructImpl<Options>,
-		public Configurable::Options::DynamicCrop<Options>
+		public Configurable::Options::DynamicCrop<Options>,
+		public Configurable::Options::FastSectorSearch<Options>
 	{
 	public:
 		Options(const Configurable::OptionsType type) :
-			Configurable::Options::DynamicCrop<Options>(type == Configurable::OptionsType::UserFriendly) {}
+			Configurable::Options::DynamicCrop<Options>(type == Configurable::OptionsType::UserFriendly),
+			Configurable::Options::FastSectorSearch<Options>(false) {}
 
 	private:
 		friend Configurable::Options::DynamicCrop<Options>;
+		friend Configurable::Options::FastSectorSearch<Options>;
 
 		Options() : Options(Configurable::OptionsType::UserFriendly) {}
 
 		friend Reflection::StructImpl<Options>;
 		void declare_fields() {
 			declare_dynamic_crop_option();
+			declare_fast_sector_search_option();
 		}
 	};
 };
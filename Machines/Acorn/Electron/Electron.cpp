@@ -16,7 +16,7 @@
 #include "ClockReceiver/ForceInline.hpp"
 #include "Configurable/StandardOptions.hpp"
 #include "Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
-#include "Processors/6502/6502.hpp"
+#include "Processors/6502Mk2/6502Mk2.hpp"
 
 #include "Storage/MassStorage/SCSI/SCSI.hpp"
 #include "Storage/MassStorage/SCSI/DirectAccessDevice.hpp"
@@ -42,7 +42,6 @@ template <bool has_scsi_bus> class ConcreteMachine:
 	public Activity::Source,
 	public ClockingHint::Observer,
 	public Configurable::Device,
-	public CPU::MOS6502::BusHandler,
 	public Machine,
 	public MachineTypes::AudioProducer,
 	public MachineTypes::MappedKeyboardMachine,
@@ -157,7 +156,7 @@ public:
 			break;
 
 			case KeyBreak:
-				m6502_.set_reset_line(isPressed);
+				m6502_.template set<CPU::MOS6502Mk2::Line::Reset>(isPressed);
 			break;
 
 #define FuncShiftedKey(source, dest)	\
@@ -231,7 +230,8 @@ public:
 		return std::make_pair(Cycles(1), video_.run_for(Cycles(1)));
 	}
 
-	forceinline Cycles perform_bus_operation(const CPU::MOS6502::BusOperation operation, const uint16_t address, uint8_t *const value) {
+	template <CPU::MOS6502Mk2::BusOperation operation, typename AddressT>
+	Cycles perform(const AddressT address, CPU::MOS6502Mk2::data_t<operation> value) {
 		const auto [cycles, video_interrupts] = run_for_access(address);
 		signal_interrupt(video_interrupts);
 
@@ -245,7 +245,7 @@ public:
 			shift_restart_counter_ -= cycles.template as<int>();
 			if(shift_restart_counter_ <= 0) {
 				shift_restart_counter_ = 0;
-				m6502_.set_power_on(true);
+				m6502_.template set<CPU::MOS6502Mk2::Line::PowerOn>(true);
 				set_key_state(KeyShift, true);
 				is_holding_shift_ = true;
 			}
@@ -257,38 +257,42 @@ public:
 			}
 		}
 
+		if constexpr (is_dataless(operation)) {
+			return cycles;
+		}
+
 		if(address < 0x8000) {
-			if(is_read(operation)) {
-				*value = ram_[address];
+			if constexpr (is_read(operation)) {
+				value = ram_[address];
 			} else {
-				ram_[address] = *value;
+				ram_[address] = value;
 			}
 		} else {
 			switch(address & 0xff0f) {
 				case 0xfe00:
-					if(is_read(operation)) {
-						*value = interrupt_status_;
+					if constexpr (is_read(operation)) {
+						value = interrupt_status_;
 						interrupt_status_ &= ~PowerOnReset;
 					} else {
-						interrupt_control_ = (*value) & ~1;
+						interrupt_control_ = (value) & ~1;
 						evaluate_interrupts();
 					}
 				break;
 				case 0xfe07:
-					if(!is_read(operation)) {
+					if constexpr (is_write(operation)) {
 						// update speaker mode
-						bool new_speaker_is_enabled = (*value & 6) == 2;
+						bool new_speaker_is_enabled = (value & 6) == 2;
 						if(new_speaker_is_enabled != speaker_is_enabled_) {
 							update_audio();
 							sound_generator_.set_is_enabled(new_speaker_is_enabled);
 							speaker_is_enabled_ = new_speaker_is_enabled;
 						}
 
-						tape_.set_is_enabled((*value & 6) != 6);
-						tape_.set_is_in_input_mode((*value & 6) == 0);
-						tape_.set_is_running((*value & 0x40) ? true : false);
+						tape_.set_is_enabled((value & 6) != 6);
+						tape_.set_is_in_input_mode((value & 6) == 0);
+						tape_.set_is_running((value & 0x40) ? true : false);
 
-						caps_led_state_ = !!(*value & 0x80);
+						caps_led_state_ = !!(value & 0x80);
 						if(activity_observer_)
 							activity_observer_->set_led_status(caps_led, caps_led_state_);
 					}
@@ -299,22 +303,22 @@ public:
 				case 0xfe02: case 0xfe03:
 				case 0xfe08: case 0xfe09: case 0xfe0a: case 0xfe0b:
 				case 0xfe0c: case 0xfe0d: case 0xfe0e: case 0xfe0f:
-					if(!is_read(operation)) {
-						video_.write(address, *value);
+					if constexpr (is_write(operation)) {
+						video_.write(address, value);
 					}
 				break;
 				case 0xfe04:
-					if(is_read(operation)) {
-						*value = tape_.get_data_register();
+					if constexpr (is_read(operation)) {
+						value = tape_.get_data_register();
 						tape_.clear_interrupts(Interrupt::ReceiveDataFull);
 					} else {
-						tape_.set_data_register(*value);
+						tape_.set_data_register(value);
 						tape_.clear_interrupts(Interrupt::TransmitDataEmpty);
 					}
 				break;
 				case 0xfe05:
-					if(!is_read(operation)) {
-						const uint8_t interruptDisable = (*value)&0xf0;
+					if constexpr (is_write(operation)) {
+						const uint8_t interruptDisable = (value)&0xf0;
 						if( interruptDisable ) {
 							if( interruptDisable&0x10 ) interrupt_status_ &= ~Interrupt::DisplayEnd;
 							if( interruptDisable&0x20 ) interrupt_status_ &= ~Interrupt::RealTimeClock;
@@ -324,15 +328,15 @@ public:
 							// TODO: NMI
 						} else {
 							// Latch the paged ROM in case external hardware is being emulated.
-							active_rom_ = *value & 0xf;
+							active_rom_ = value & 0xf;
 
 							// apply the ULA's test
-							if(*value & 0x08) {
-								if(*value & 0x04) {
+							if(value & 0x08) {
+								if(value & 0x04) {
 									keyboard_is_active_ = false;
 									basic_is_active_ = false;
 								} else {
-									keyboard_is_active_ = !(*value & 0x02);
+									keyboard_is_active_ = !(value & 0x02);
 									basic_is_active_ = !keyboard_is_active_;
 								}
 							}
@@ -340,10 +344,10 @@ public:
 					}
 				break;
 				case 0xfe06:
-					if(!is_read(operation)) {
+					if constexpr (is_write(operation)) {
 						update_audio();
-						sound_generator_.set_divider(*value);
-						tape_.set_counter(*value);
+						sound_generator_.set_divider(value);
+						tape_.set_counter(value);
 					}
 				break;
 
@@ -353,26 +357,28 @@ public:
 							is_holding_shift_ = false;
 							set_key_state(KeyShift, false);
 						}
-						if(is_read(operation))
-							*value = plus3_->read(address);
+						if constexpr (is_read(operation))
+							value = plus3_->read(address);
 						else
-							plus3_->write(address, *value);
+							plus3_->write(address, value);
 					}
 				break;
 				case 0xfc00:
 					if(plus3_ && (address&0x00f0) == 0x00c0) {
-						if(!is_read(operation)) {
-							plus3_->set_control_register(*value);
-						} else *value = 1;
+						if constexpr (is_read(operation)) {
+							value = 1;
+						} else {
+							plus3_->set_control_register(value);
+						}
 					}
 
 					if(has_scsi_bus && (address&0x00f0) == 0x0040) {
 						scsi_acknowledge_ = true;
-						if(!is_read(operation)) {
-							scsi_data_ = *value;
+						if constexpr (is_read(operation)) {
+							value = SCSI::data_lines(scsi_bus_.state());
 							push_scsi_output();
 						} else {
-							*value = SCSI::data_lines(scsi_bus_.state());
+							scsi_data_ = value;
 							push_scsi_output();
 						}
 					}
@@ -380,36 +386,40 @@ public:
 				case 0xfc03:
 					if(has_scsi_bus && (address&0x00f0) == 0x0040) {
 						scsi_interrupt_state_ = false;
-						scsi_interrupt_mask_ = *value & 1;
+						if constexpr (is_write(operation)) {
+							scsi_interrupt_mask_ = value & 1;
+						}
 						evaluate_interrupts();
 					}
 				break;
 				case 0xfc01:
-					if(has_scsi_bus && (address&0x00f0) == 0x0040 && is_read(operation)) {
-						// Status byte is:
-						//
-						//	b7:	SCSI C/D
-						//	b6: SCSI I/O
-						//	b5: SCSI REQ
-						//	b4: interrupt flag
-						//	b3:	0
-						//	b2:	0
-						//	b1:	SCSI BSY
-						//	b0: SCSI MSG
-						const auto state = scsi_bus_.state();
-						*value =
-							(state & SCSI::Line::Control ? 0x80 : 0x00) |
-							(state & SCSI::Line::Input ? 0x40 : 0x00) |
-							(state & SCSI::Line::Request ? 0x20 : 0x00) |
-							((scsi_interrupt_state_ && scsi_interrupt_mask_) ? 0x10 : 0x00) |
-							(state & SCSI::Line::Busy ? 0x02 : 0x00) |
-							(state & SCSI::Line::Message ? 0x01 : 0x00);
-
-						// Empirical guess: this is also the trigger to affect busy/request/acknowledge
-						// signalling. Maybe?
-						if(scsi_select_ && scsi_bus_.state() & SCSI::Line::Busy) {
-							scsi_select_ = false;
-							push_scsi_output();
+					if constexpr (is_read(operation)) {
+						if(has_scsi_bus && (address&0x00f0) == 0x0040) {
+							// Status byte is:
+							//
+							//	b7:	SCSI C/D
+							//	b6: SCSI I/O
+							//	b5: SCSI REQ
+							//	b4: interrupt flag
+							//	b3:	0
+							//	b2:	0
+							//	b1:	SCSI BSY
+							//	b0: SCSI MSG
+							const auto state = scsi_bus_.state();
+							value =
+								(state & SCSI::Line::Control ? 0x80 : 0x00) |
+								(state & SCSI::Line::Input ? 0x40 : 0x00) |
+								(state & SCSI::Line::Request ? 0x20 : 0x00) |
+								((scsi_interrupt_state_ && scsi_interrupt_mask_) ? 0x10 : 0x00) |
+								(state & SCSI::Line::Busy ? 0x02 : 0x00) |
+								(state & SCSI::Line::Message ? 0x01 : 0x00);
+
+							// Empirical guess: this is also the trigger to affect busy/request/acknowledge
+							// signalling. Maybe?
+							if(scsi_select_ && scsi_bus_.state() & SCSI::Line::Busy) {
+								scsi_select_ = false;
+								push_scsi_output();
+							}
 						}
 					}
 				break;
@@ -435,10 +445,10 @@ public:
 
 				default:
 					if(address >= 0xc000) {
-						if(is_read(operation)) {
+						if constexpr (is_read(operation)) {
 							if(
 								use_fast_tape_hack_ &&
-								(operation == CPU::MOS6502::BusOperation::ReadOpcode) &&
+								(operation == CPU::MOS6502Mk2::BusOperation::ReadOpcode) &&
 								(
 									(address == 0xf4e5) || (address == 0xf4e6) ||	// double NOPs at 0xf4e5, 0xf6de, 0xf6fa and 0xfa51
 									(address == 0xf6de) || (address == 0xf6df) ||	// act to disable the normal branch into tape-handling
@@ -455,7 +465,7 @@ public:
 																					// allow the PC read to return an RTS.
 								)
 							) {
-								const auto service_call = uint8_t(m6502_.value_of(CPU::MOS6502::Register::X));
+								const auto service_call = m6502_.registers().x;
 								if(address == 0xf0a8) {
 									if(!ram_[0x247] && service_call == 14) {
 										tape_.set_delegate(nullptr);
@@ -475,31 +485,34 @@ public:
 										interrupt_status_ |= tape_.get_interrupt_status();
 
 										fast_load_is_in_data_ = true;
-										m6502_.set_value_of(CPU::MOS6502::Register::A, 0);
-										m6502_.set_value_of(CPU::MOS6502::Register::Y, tape_.get_data_register());
-										*value = 0x60; // 0x60 is RTS
+										auto registers = m6502_.registers();
+										registers.a = 0;
+										registers.y = tape_.get_data_register();
+										m6502_.set_registers(registers);
+										value = 0x60; // 0x60 is RTS
 									}
-									else *value = os_[address & 16383];
+									else value = os_[address & 16383];
 								}
-								else *value = 0xea;
+								else value = 0xea;
 							} else {
-								*value = os_[address & 16383];
+								value = os_[address & 16383];
 							}
 						}
 					} else {
-						if(is_read(operation)) {
-							*value = roms_[active_rom_][address & 16383];
+						if constexpr (is_read(operation)) {
+							uint8_t result = roms_[active_rom_][address & 16383];
 							if(keyboard_is_active_) {
-								*value &= 0xf0;
+								result &= 0xf0;
 								for(int address_line = 0; address_line < 14; address_line++) {
-									if(!(address&(1 << address_line))) *value |= key_states_[address_line];
+									if(!(address&(1 << address_line))) result |= key_states_[address_line];
 								}
 							}
 							if(basic_is_active_) {
-								*value &= roms_[int(ROM::BASIC)][address & 16383];
+								result &= roms_[int(ROM::BASIC)][address & 16383];
 							}
+							value = result;
 						} else if(rom_write_masks_[active_rom_]) {
-							roms_[active_rom_][address & 16383] = *value;
+							roms_[active_rom_][address & 16383] = value;
 						}
 					}
 				break;
@@ -568,7 +581,7 @@ public:
 	}
 
 	HalfCycles typer_delay(const std::wstring &text) const final {
-		if(!m6502_.get_is_resetting()) {
+		if(!m6502_.is_resetting()) {
 			return Cycles(0);
 		}
 
@@ -601,6 +614,7 @@ public:
 		auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 		options->output = get_video_signal_configurable();
 		options->quick_load = allow_fast_tape_hack_;
+		options->fast_sector_search = plus3_ && plus3_->get_is_fast_sector_search();
 		return options;
 	}
 
@@ -610,6 +624,7 @@ public:
 		set_video_signal_configurable(options->output);
 		allow_fast_tape_hack_ = options->quick_load;
 		set_use_fast_tape_hack();
+		if(plus3_) plus3_->set_is_fast_sector_search(options->fast_sector_search);
 	}
 
 	// MARK: - Activity Source
@@ -709,13 +724,18 @@ private:
 		}
 
 		if constexpr (has_scsi_bus) {
-			m6502_.set_irq_line((scsi_interrupt_state_ && scsi_interrupt_mask_) | (interrupt_status_ & 1));
+			m6502_.template set<CPU::MOS6502Mk2::Line::IRQ>((scsi_interrupt_state_ && scsi_interrupt_mask_) | (interrupt_status_ & 1));
 		} else {
-			m6502_.set_irq_line(interrupt_status_ & 1);
+			m6502_.template set<CPU::MOS6502Mk2::Line::IRQ>(interrupt_status_ & 1);
 		}
 	}
 
-	CPU::MOS6502::Processor<CPU::MOS6502::Personality::P6502, ConcreteMachine, false> m6502_;
+	struct M6502Traits {
+		static constexpr auto uses_ready_line = false;
+		static constexpr auto pause_precision = CPU::MOS6502Mk2::PausePrecision::BetweenInstructions;
+		using BusHandlerT = ConcreteMachine;
+	};
+	CPU::MOS6502Mk2::Processor<CPU::MOS6502Mk2::Model::M6502, M6502Traits> m6502_;
 
 	// Things that directly constitute the memory map.
 	uint8_t roms_[16][16384];
@@ -33,10 +33,12 @@ struct Machine {
 	class Options:
 		public Reflection::StructImpl<Options>,
 		public Configurable::Options::Display<Options>,
-		public Configurable::Options::QuickLoad<Options>
+		public Configurable::Options::QuickLoad<Options>,
+		public Configurable::Options::FastSectorSearch<Options>
 	{
 		friend Configurable::Options::Display<Options>;
 		friend Configurable::Options::QuickLoad<Options>;
+		friend Configurable::Options::FastSectorSearch<Options>;
 	public:
 		Options(const Configurable::OptionsType type) :
 			Configurable::Options::Display<Options>(
@@ -44,7 +46,8 @@ struct Machine {
 					Configurable::Display::RGB : Configurable::Display::CompositeColour
 			),
 			Configurable::Options::QuickLoad<Options>(
-				type == Configurable::OptionsType::UserFriendly) {}
+				type == Configurable::OptionsType::UserFriendly),
+			Configurable::Options::FastSectorSearch<Options>(false) {}
 
 	private:
 		Options() : Options(Configurable::OptionsType::UserFriendly) {}
@@ -53,6 +56,7 @@ struct Machine {
 		void declare_fields() {
 			declare_display_option();
 			declare_quickload_option();
+			declare_fast_sector_search_option();
 			limit_enum(
 				&output,
 				Configurable::Display::RGB,
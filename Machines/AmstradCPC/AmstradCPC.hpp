@@ -31,18 +31,21 @@ struct Machine {
 		public Reflection::StructImpl<Options>,
 		public Configurable::Options::Display<Options>,
 		public Configurable::Options::QuickLoad<Options>,
-		public Configurable::Options::DynamicCrop<Options>
+		public Configurable::Options::DynamicCrop<Options>,
+		public Configurable::Options::FastSectorSearch<Options>
 	{
 	public:
 		Options(const Configurable::OptionsType type) :
 			Configurable::Options::Display<Options>(Configurable::Display::RGB),
 			Configurable::Options::QuickLoad<Options>(type == Configurable::OptionsType::UserFriendly),
-			Configurable::Options::DynamicCrop<Options>(type == Configurable::OptionsType::UserFriendly) {}
+			Configurable::Options::DynamicCrop<Options>(type == Configurable::OptionsType::UserFriendly),
+			Configurable::Options::FastSectorSearch<Options>(false) {}
 
 	private:
 		friend Configurable::Options::Display<Options>;
 		friend Configurable::Options::QuickLoad<Options>;
 		friend Configurable::Options::DynamicCrop<Options>;
+		friend Configurable::Options::FastSectorSearch<Options>;
 
 		Options() : Options(Configurable::OptionsType::UserFriendly) {}
 
@@ -51,6 +54,7 @@ struct Machine {
 			declare_display_option();
 			declare_quickload_option();
 			declare_dynamic_crop_option();
+			declare_fast_sector_search_option();
 			limit_enum(&output, Configurable::Display::RGB, Configurable::Display::CompositeColour, -1);
 		}
 	};
@@ -13,7 +13,7 @@
 #include "Machines/Utility/MemoryFuzzer.hpp"
 #include "Machines/Utility/StringSerialiser.hpp"
 
-#include "Processors/6502/6502.hpp"
+#include "Processors/6502Mk2/6502Mk2.hpp"
 #include "Components/AudioToggle/AudioToggle.hpp"
 #include "Components/AY38910/AY38910.hpp"
 
@@ -116,7 +116,6 @@ template <Analyser::Static::AppleII::Target::Model model, bool has_mockingboard>
 	public MachineTypes::MediaTarget,
 	public MachineTypes::MappedKeyboardMachine,
 	public MachineTypes::JoystickMachine,
-	public CPU::MOS6502::BusHandler,
 	public Configurable::Device,
 	public Activity::Source,
 	public Apple::II::Card::Delegate {
@@ -139,10 +138,15 @@ private:
 		uint8_t *ram_, *aux_ram_;
 	};
 
-	using Processor = CPU::MOS6502::Processor<
-		(model == Analyser::Static::AppleII::Target::Model::EnhancedIIe) ? CPU::MOS6502::Personality::PSynertek65C02 : CPU::MOS6502::Personality::P6502,
-		ConcreteMachine,
-		false>;
+	struct M6502Traits {
+		static constexpr auto uses_ready_line = false;
+		static constexpr auto pause_precision = CPU::MOS6502Mk2::PausePrecision::BetweenInstructions;
+		using BusHandlerT = ConcreteMachine;
+	};
+	using Processor = CPU::MOS6502Mk2::Processor<
+		(model == Analyser::Static::AppleII::Target::Model::EnhancedIIe) ?
+			CPU::MOS6502Mk2::Model::Synertek65C02 : CPU::MOS6502Mk2::Model::M6502,
+		M6502Traits>;
 	Processor m6502_;
 	VideoBusHandler video_bus_handler_;
 	Apple::II::Video::Video<VideoBusHandler, is_iie(model)> video_;
@@ -241,8 +245,8 @@ private:
 				irq |= card->irq();
 			}
 		}
-		m6502_.set_nmi_line(nmi);
-		m6502_.set_irq_line(irq);
+		m6502_.template set<CPU::MOS6502Mk2::Line::NMI>(nmi);
+		m6502_.template set<CPU::MOS6502Mk2::Line::IRQ>(irq);
 	}
 
 	Apple::II::Mockingboard *mockingboard() {
@@ -459,7 +463,7 @@ private:
 					// Accept a bunch of non-symbolic other keys, as
 					// reset, in the hope that the user can find
 					// at least one usable key.
-					m6502_.set_reset_line(is_pressed);
+					m6502_.template set<CPU::MOS6502Mk2::Line::Reset>(is_pressed);
 					if(!is_pressed) {
 						auxiliary_switches_.reset();
 					}
@@ -707,7 +711,9 @@ public:
 		return &speaker_;
 	}
 
-	forceinline Cycles perform_bus_operation(const CPU::MOS6502::BusOperation operation, const uint16_t address, uint8_t *const value) {
+	template <CPU::MOS6502Mk2::BusOperation operation, typename AddressT>
+	forceinline Cycles perform(const AddressT bus_address, CPU::MOS6502Mk2::data_t<operation> value) {
+		const uint16_t address = bus_address;
 		++ cycles_since_video_update_;
 		++ cycles_since_card_update_;
 		cycles_since_audio_update_ += Cycles(7);
@@ -725,12 +731,25 @@ public:
 			++ stretched_cycles_since_card_update_;
 		}
 
+		// Neither processor used here has anything attached to RDY, so the only dataless cycles are
+		// those of STP and WAI, which the Synertek 65C02 doesn't implement.
+		if constexpr (is_dataless(operation)) {
+			return Cycles(1);
+		}
+
+		// Everything below sees the data bus as a single byte, as on the real machine; a read
+		// starts with all lines high.
+		uint8_t data = 0xff;
+		if constexpr (is_write(operation)) {
+			data = value;
+		}
+
 		bool has_updated_cards = false;
 		if(read_pages_[address >> 8]) {
-			if(is_read(operation)) *value = read_pages_[address >> 8][address & 0xff];
+			if(is_read(operation)) data = read_pages_[address >> 8][address & 0xff];
 			else {
 				if(address >= 0x200 && address < 0x6000) update_video();
-				if(write_pages_[address >> 8]) write_pages_[address >> 8][address & 0xff] = *value;
+				if(write_pages_[address >> 8]) write_pages_[address >> 8][address & 0xff] = data;
 			}
 
 			if(is_iie(model)) {
@@ -756,7 +775,7 @@ public:
 				if(video_.has_deferred_actions()) {
 					update_video();
 				}
-				*value = video_.get_last_read_value(cycles_since_video_update_);
+				data = video_.get_last_read_value(cycles_since_video_update_);
 			}
 
 			switch(address) {
@@ -767,33 +786,33 @@ public:
 							default: break;
 
 							case 0xc000:
-								*value = keyboard_.get_keyboard_input();
+								data = keyboard_.get_keyboard_input();
 							break;
 							case 0xc001: case 0xc002: case 0xc003: case 0xc004: case 0xc005: case 0xc006: case 0xc007:
 							case 0xc008: case 0xc009: case 0xc00a: case 0xc00b: case 0xc00c: case 0xc00d: case 0xc00e: case 0xc00f:
-								*value = (*value & 0x80) | (keyboard_.get_keyboard_input() & 0x7f);
+								data = (data & 0x80) | (keyboard_.get_keyboard_input() & 0x7f);
 							break;
 
 							case 0xc061:	// Switch input 0.
-								*value &= 0x7f;
+								data &= 0x7f;
 								if(
 									joysticks_.button(0) ||
 									(is_iie(model) && keyboard_.open_apple_is_pressed)
 								)
-									*value |= 0x80;
+									data |= 0x80;
 							break;
 							case 0xc062:	// Switch input 1.
-								*value &= 0x7f;
+								data &= 0x7f;
 								if(
 									joysticks_.button(1) ||
 									(is_iie(model) && keyboard_.closed_apple_is_pressed)
 								)
-									*value |= 0x80;
+									data |= 0x80;
 							break;
 							case 0xc063:	// Switch input 2.
-								*value &= 0x7f;
+								data &= 0x7f;
 								if(joysticks_.button(2))
-									*value |= 0x80;
+									data |= 0x80;
 							break;
 
 							case 0xc064:	// Analogue input 0.
@@ -801,14 +820,14 @@ public:
 							case 0xc066:	// Analogue input 2.
 							case 0xc067: {	// Analogue input 3.
 								const size_t input = address - 0xc064;
-								*value &= 0x7f;
+								data &= 0x7f;
 								if(!joysticks_.analogue_channel_is_discharged(input)) {
-									*value |= 0x80;
+									data |= 0x80;
 								}
 							} break;
 
 							// The IIe-only state reads follow...
-#define IIeSwitchRead(s)	*value = keyboard_.get_keyboard_input(); if(is_iie(model)) *value = (*value & 0x7f) | (s ? 0x80 : 0x00);
+#define IIeSwitchRead(s)	data = keyboard_.get_keyboard_input(); if(is_iie(model)) data = (data & 0x7f) | (s ? 0x80 : 0x00);
 							case 0xc011:	IIeSwitchRead(language_card_.state().bank2);								break;
 							case 0xc012:	IIeSwitchRead(language_card_.state().read);									break;
 							case 0xc013:	IIeSwitchRead(auxiliary_switches_.switches().read_auxiliary_memory);		break;
@@ -827,7 +846,7 @@ public:
 #undef IIeSwitchRead
 
 							case 0xc07f:
-								if(is_iie(model)) *value = (*value & 0x7f) | (video_.get_annunciator_3() ? 0x80 : 0x00);
+								if(is_iie(model)) data = (data & 0x7f) | (video_.get_annunciator_3() ? 0x80 : 0x00);
 							break;
 						}
 					} else {
@@ -895,7 +914,7 @@ public:
 
 					// On the IIe, reading C010 returns additional key info.
 					if(is_iie(model) && is_read(operation)) {
-						*value = (keyboard_.get_key_is_down() ? 0x80 : 0x00) | (keyboard_.get_keyboard_input() & 0x7f);
+						data = (keyboard_.get_key_is_down() ? 0x80 : 0x00) | (keyboard_.get_keyboard_input() & 0x7f);
 					}
 				break;
 
@@ -955,11 +974,11 @@ public:
 
 				// If the selected card is a just-in-time card, update the just-in-time cards,
 				// and then message it specifically.
-				const bool is_read = CPU::MOS6502Esque::is_read(operation);
+				const bool is_read = CPU::MOS6502Mk2::is_read(operation);
 				Apple::II::Card *const target = cards_[size_t(card_number)].get();
 				if(target && !is_every_cycle_card(target)) {
 					update_just_in_time_cards();
-					target->perform_bus_operation(select, is_read, address, value);
+					target->perform_bus_operation(select, is_read, address, &data);
 				}
 
 				// Update all the every-cycle cards regardless, but send them a ::None select if they're
@@ -968,7 +987,7 @@ public:
 					card->run_for(Cycles(1), is_stretched_cycle);
 					card->perform_bus_operation(
 						(card == target) ? select : Apple::II::Card::None,
-						is_read, address, value);
+						is_read, address, &data);
 				}
 				has_updated_cards = true;
 			}
@@ -976,10 +995,10 @@ public:
 
 		if(!has_updated_cards && !every_cycle_cards_.empty()) {
 			// Update all every-cycle cards and give them the cycle.
-			const bool is_read = CPU::MOS6502Esque::is_read(operation);
+			const bool is_read = CPU::MOS6502Mk2::is_read(operation);
 			for(const auto &card: every_cycle_cards_) {
 				card->run_for(Cycles(1), is_stretched_cycle);
-				card->perform_bus_operation(Apple::II::Card::None, is_read, address, value);
+				card->perform_bus_operation(Apple::II::Card::None, is_read, address, &data);
 			}
 		}
 
@@ -1011,6 +1030,10 @@ public:
 		// Update analogue charge level.
 		joysticks_.update_charge();
 
+		if constexpr (is_read(operation)) {
+			value = data;
+		}
+
 		return Cycles(1);
 	}
 
@@ -8,7 +8,6 @@
 
 #pragma once
 
-#include "Processors/6502/6502.hpp"
 #include "ClockReceiver/ClockReceiver.hpp"
 #include "Activity/Observer.hpp"
 
@@ -12,32 +12,16 @@
 #include <cstdio>
 #include <numeric>
 
-// TODO: is it safe not to check for back-pressure in pending_stores_?
-
 using namespace Apple::IIgs::Sound;
 
-GLU::GLU(Concurrency::AsyncTaskQueue<false> &audio_queue) : audio_queue_(audio_queue) {
-	// Reset all pending stores.
-	MemoryWrite disabled_write;
-	disabled_write.enabled = false;
-	for(int c = 0; c < StoreBufferSize; c++) {
-		pending_stores_[c].store(disabled_write);
-	}
-}
+GLU::GLU(Concurrency::AsyncTaskQueue<false> &audio_queue) :
+	audio_queue_(audio_queue), pending_stores_(*this, audio_queue) {}
 
 void GLU::set_data(uint8_t data) {
 	if(local_.control & 0x40) {
 		// RAM access.
 		local_.ram_[address_] = data;
-
-		MemoryWrite write;
-		write.enabled = true;
-		write.address = address_;
-		write.value = data;
-		write.time = pending_store_write_time_;
-		pending_stores_[pending_store_write_].store(write, std::memory_order_release);
-
-		pending_store_write_ = (pending_store_write_ + 1) % (StoreBufferSize - 1);
+		pending_stores_.push(MemoryWrite{address_, data});
 	} else {
 		// Register access.
 		const auto address = address_;	// To make sure I don't inadvertently 'capture' address_.
@@ -52,6 +36,10 @@ void GLU::set_data(uint8_t data) {
 	}
 }
 
+void GLU::apply(const MemoryWrite &write) {
+	remote_.ram_[write.address] = write.value;
+}
+
 void GLU::EnsoniqState::set_register(uint16_t address, uint8_t value) {
 	switch(address & 0xe0) {
 		case 0x00:
@@ -154,40 +142,19 @@ bool GLU::get_interrupt_line() {
 void GLU::run_for(Cycles cycles) {
 	// Update local state, without generating audio.
 	skip_audio(local_, cycles.as<size_t>());
-
-	// Update the timestamp for memory writes;
-	pending_store_write_time_ += cycles.as<uint32_t>();
 }
 
 template <Outputs::Speaker::Action action>
 void GLU::apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target) {
-	// Update remote state, generating audio.
-	generate_audio<action>(number_of_samples, target);
+	// Update remote state, generating audio and applying memory writes as they fall due.
+	pending_stores_.generate(number_of_samples, target, [&](const std::size_t length, Outputs::Speaker::MonoSample *const segment) {
+		generate_audio<action>(length, segment);
+	});
 }
 template void GLU::apply_samples<Outputs::Speaker::Action::Mix>(std::size_t, Outputs::Speaker::MonoSample *);
 template void GLU::apply_samples<Outputs::Speaker::Action::Store>(std::size_t, Outputs::Speaker::MonoSample *);
 template void GLU::apply_samples<Outputs::Speaker::Action::Ignore>(std::size_t, Outputs::Speaker::MonoSample *);
 
-
-//void GLU::skip_samples(const std::size_t number_of_samples) {
-//	// Update remote state, without generating audio.
-//	skip_audio(remote_, number_of_samples);
-//
-//	// Apply any pending stores.
-//	std::atomic_thread_fence(std::memory_order_acquire);
-//	const uint32_t final_time = pending_store_read_time_ + uint32_t(number_of_samples);
-//	while(true) {
-//		auto next_store = pending_stores_[pending_store_read_].load(std::memory_order_acquire);
-//		if(!next_store.enabled) break;
-//		if(next_store.time >= final_time) break;
-//		remote_.ram_[next_store.address] = next_store.value;
-//		next_store.enabled = false;
-//		pending_stores_[pending_store_read_].store(next_store, std::memory_order_relaxed);
-//
-//		pending_store_read_ = (pending_store_read_ + 1) & (StoreBufferSize - 1);
-//	}
-//}
-
 void GLU::set_sample_volume_range(std::int16_t range) {
 	output_range_ = range;
 }
@@ -263,7 +230,6 @@ void GLU::skip_audio(EnsoniqState &state, size_t number_of_samples) {
 
 template <Outputs::Speaker::Action action>
 void GLU::generate_audio(size_t number_of_samples, Outputs::Speaker::MonoSample *target) {
-	auto next_store = pending_stores_[pending_store_read_].load(std::memory_order_acquire);
 	uint8_t next_amplitude = 255;
 	for(size_t sample = 0; sample < number_of_samples; sample++) {
 
@@ -337,15 +303,6 @@ void GLU::generate_audio(size_t number_of_samples, Outputs::Speaker::MonoSample
 				(output * output_range_) >> 20
 			)
 		);
-
-		// Apply any RAM writes that interleave here.
-		++pending_store_read_time_;
-		if(!next_store.enabled) continue;
-		if(next_store.time != pending_store_read_time_) continue;
-		remote_.ram_[next_store.address] = next_store.value;
-		next_store.enabled = false;
-		pending_stores_[pending_store_read_].store(next_store, std::memory_order_relaxed);
-		pending_store_read_ = (pending_store_read_ + 1) & (StoreBufferSize - 1);
 	}
 }
 
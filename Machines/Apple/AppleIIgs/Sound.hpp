@@ -8,11 +8,10 @@
 
 #pragma once
 
-#include <atomic>
-
 #include "ClockReceiver/ClockReceiver.hpp"
 #include "Concurrency/AsyncTaskQueue.hpp"
 #include "Outputs/Speaker/Implementation/BufferSource.hpp"
+#include "Outputs/Speaker/Implementation/RegisterWriteLog.hpp"
 
 namespace Apple::IIgs::Sound {
 
@@ -38,6 +37,8 @@ public:
 	void apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target);
 	void set_sample_volume_range(std::int16_t range);
 	bool is_zero_level() const { return false; }	// TODO.
+	void will_run_for(const Cycles cycles) {	pending_stores_.will_run_for(cycles);	}
+	void did_run_for(const Cycles cycles) {		pending_stores_.did_run_for(cycles);	}
 
 private:
 	Concurrency::AsyncTaskQueue<false> &audio_queue_;
@@ -46,21 +47,13 @@ private:
 
 	// Use a circular buffer for piping memory alterations onto the audio
 	// thread; it would be prohibitive to defer every write individually.
-	//
-	// Assumed: on most modern architectures, an atomic 64-bit read or
-	// write can be achieved locklessly.
 	struct MemoryWrite {
-		uint32_t time;
 		uint16_t address;
 		uint8_t value;
-		bool enabled;
 	};
-	static_assert(sizeof(MemoryWrite) == 8);
-	static constexpr int StoreBufferSize = 16384;
-
-	std::atomic<MemoryWrite> pending_stores_[StoreBufferSize];
-	uint32_t pending_store_read_ = 0, pending_store_read_time_ = 0;
-	uint32_t pending_store_write_ = 0, pending_store_write_time_ = 0;
+	friend Outputs::Speaker::RegisterWriteLog<GLU, MemoryWrite, 16384>;
+	Outputs::Speaker::RegisterWriteLog<GLU, MemoryWrite, 16384> pending_stores_;
+	void apply(const MemoryWrite &);
 
 	// Maintain state both 'locally' (i.e. on the emulation thread) and
 	// 'remotely' (i.e. on the audio thread).
@@ -141,7 +141,10 @@ public:
 		if(!request.validate(roms)) {
 			throw ROMMachine::Error::MissingROMs;
 		}
-		Memory::PackBigEndian16(roms.find(rom_name)->second, rom_);
+		std::vector<uint8_t> rom;
+		Memory::PackBigEndian16(roms.find(rom_name)->second, rom);
+		rom.resize(rom_size);
+		rom_ = ROM::shared_image(rom_name, std::move(rom));
 
 		// Randomise memory contents.
 		Memory::Fuzz(ram_);
@@ -355,8 +358,12 @@ public:
 				// It embodies knowledge of the fact that video (and audio) will always
 				// be fetched from the final $d900 bytes of memory.
 				// (And that ram_mask_ = ram size - 1).
-				if(address > ram_mask_ - 0xd900)
+				if(address > ram_mask_ - 0xd900) {
 					update_video();
+					if(!(cycle.operation & CPU::MC68000::Operation::Read)) {
+						video_.did_write(address & ram_mask_);
+					}
+				}
 
 				memory_base = ram_.data();
 				address &= ram_mask_;
@@ -373,7 +380,8 @@ public:
 
 			case BusDevice::ROM: {
 				if(!(cycle.operation & CPU::MC68000::Operation::Read)) return delay;
-				memory_base = rom_;
+				// The ROM is shared and immutable, but writes have been rejected above.
+				memory_base = const_cast<uint8_t *>(rom_->data());
 				address &= rom_mask_;
 			} break;
 		}
@@ -854,7 +862,7 @@ private:
 
 	uint32_t ram_mask_ = 0;
 	uint32_t rom_mask_ = 0;
-	uint8_t rom_[128*1024];
+	ROM::Image rom_;
 	std::vector<uint8_t> ram_;
 };
 
@@ -52,7 +52,7 @@ Outputs::Display::ScanStatus Video::get_scaled_scan_status() const {
 
 void Video::run_for(HalfCycles duration) {
 	// Determine the current video and audio bases. These values don't appear to be latched, they apply immediately.
-	const size_t video_base = (use_alternate_screen_buffer_ ? (0xffff2700 >> 1) : (0xffffa700 >> 1)) & ram_mask_;
+	const size_t video_base = this->video_base();
 	const size_t audio_base = (use_alternate_audio_buffer_ ? (0xffffa100 >> 1) : (0xfffffd00 >> 1)) & ram_mask_;
 
 	// The number of HalfCycles is literally the number of pixel clocks to move through,
@@ -85,10 +85,10 @@ void Video::run_for(HalfCycles duration) {
 					const int final_pixel_word = std::min(final_word, 32);
 
 					if(!first_word) {
-						pixel_buffer_ = reinterpret_cast<uint64_t *>(crt_.begin_data(512, 8));
+						pixel_buffer_ = line_cache_.begin_line<uint64_t>(size_t(line));
 					}
 
-					if(pixel_buffer_) {
+					if(line_cache_.needs_generation()) {
 						for(int c = first_word; c < final_pixel_word; ++c) {
 							const uint16_t pixels = ram_[video_base + video_address_] ^ 0xffff;
 							++video_address_;
@@ -102,10 +102,11 @@ void Video::run_for(HalfCycles duration) {
 						}
 					} else {
 						video_address_ += size_t(final_pixel_word - first_word);
+						pixel_buffer_ += 2 * (final_pixel_word - first_word);
 					}
 
 					if(final_pixel_word == 32) {
-						crt_.output_data(512);
+						line_cache_.output(crt_, 512);
 						pixel_buffer_ = nullptr;
 					}
 				}
@@ -175,7 +176,21 @@ HalfCycles Video::next_sequence_point() {
 	}
 }
 
+size_t Video::video_base() const {
+	return (use_alternate_screen_buffer_ ? (0xffff2700 >> 1) : (0xffffa700 >> 1)) & ram_mask_;
+}
+
+void Video::did_write(const uint32_t address) {
+	const size_t offset = ((address >> 1) - video_base()) & ram_mask_;
+	if(offset < 342 * 32) {
+		line_cache_.invalidate(offset >> 5);
+	}
+}
+
 void Video::set_use_alternate_buffers(bool use_alternate_screen_buffer, bool use_alternate_audio_buffer) {
+	if(use_alternate_screen_buffer != use_alternate_screen_buffer_) {
+		line_cache_.invalidate_all();
+	}
 	use_alternate_screen_buffer_ = use_alternate_screen_buffer;
 	use_alternate_audio_buffer_ = use_alternate_audio_buffer;
 }
@@ -183,6 +198,7 @@ void Video::set_use_alternate_buffers(bool use_alternate_screen_buffer, bool use
 void Video::set_ram(const uint16_t *const ram, const uint32_t mask) {
 	ram_ = ram;
 	ram_mask_ = mask;
+	line_cache_.invalidate_all();
 
 	// Now that RAM is assigned, the CRT cna be warmed.
 	crt_.set_fixed_framing([&] {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Outputs/CRT/CRT.hpp"
+#include "Outputs/CRT/LineCache.hpp"
 #include "ClockReceiver/ClockReceiver.hpp"
 #include "DeferredAudio.hpp"
 #include "DriveSpeedAccumulator.hpp"
@@ -59,6 +60,12 @@ public:
 	*/
 	void set_ram(const uint16_t *ram, uint32_t mask);
 
+	/*!
+		Notes that the byte at @c address, within RAM as supplied to @c set_ram, has been written to,
+		so that any affected line will be regenerated.
+	*/
+	void did_write(uint32_t address);
+
 	/*!
 		@returns @c true if the video is currently outputting a vertical sync, @c false otherwise.
 	*/
@@ -95,6 +102,8 @@ private:
 	size_t audio_address_ = 0;
 
 	uint64_t *pixel_buffer_ = nullptr;
+	Outputs::CRT::LineCache<uint8_t, 512, 342> line_cache_;
+	size_t video_base() const;
 
 	bool use_alternate_screen_buffer_ = false;
 	bool use_alternate_audio_buffer_ = false;
@@ -18,7 +18,7 @@ public:
 		last_opcode_(0x00) {}
 
 	void perform_bus_operation(
-		const CPU::MOS6502::BusOperation operation,
+		const CPU::MOS6502Mk2::BusOperation operation,
 		const uint16_t address,
 		uint8_t *const value
 	) {
@@ -27,7 +27,7 @@ public:
 		// This is a bit of a hack; a real cartridge can't see either the sync or read lines, and can't see
 		// address line 13. Instead it looks for a pattern in recent address accesses that would imply an
 		// RST or JSR.
-		if(operation == CPU::MOS6502::BusOperation::ReadOpcode && (last_opcode_ == 0x20 || last_opcode_ == 0x60)) {
+		if(operation == CPU::MOS6502Mk2::BusOperation::ReadOpcode && (last_opcode_ == 0x20 || last_opcode_ == 0x60)) {
 			if(address & 0x2000) {
 				rom_ptr_ = rom_base_;
 			} else {
@@ -39,7 +39,7 @@ public:
 			*value = rom_ptr_[address & 4095];
 		}
 
-		if(operation == CPU::MOS6502::BusOperation::ReadOpcode) last_opcode_ = *value;
+		if(operation == CPU::MOS6502Mk2::BusOperation::ReadOpcode) last_opcode_ = *value;
 	}
 
 private:
@@ -19,7 +19,7 @@ public:
 		rom_ptr_(rom_base) {}
 
 	void perform_bus_operation(
-		const CPU::MOS6502::BusOperation operation,
+		const CPU::MOS6502Mk2::BusOperation operation,
 		uint16_t address,
 		uint8_t *const value
 	) {
@@ -44,7 +44,7 @@ public:
 		rom_ptr_(rom_base) {}
 
 	void perform_bus_operation(
-		const CPU::MOS6502::BusOperation operation,
+		const CPU::MOS6502Mk2::BusOperation operation,
 		uint16_t address,
 		uint8_t *const value
 	) {
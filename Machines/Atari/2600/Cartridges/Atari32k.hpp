@@ -18,7 +18,7 @@ public:
 		: BusExtender(rom_base, rom_size), rom_ptr_(rom_base) {}
 
 	void perform_bus_operation(
-		const CPU::MOS6502::BusOperation operation,
+		const CPU::MOS6502Mk2::BusOperation operation,
 		uint16_t address,
 		uint8_t *const value
 	) {
@@ -42,7 +42,7 @@ public:
 		: BusExtender(rom_base, rom_size), rom_ptr_(rom_base) {}
 
 	void perform_bus_operation(
-		const CPU::MOS6502::BusOperation operation,
+		const CPU::MOS6502Mk2::BusOperation operation,
 		uint16_t address,
 		uint8_t *const value
 	) {
@@ -8,12 +8,12 @@
 
 #pragma once
 
-#include "Processors/6502/6502.hpp"
+#include "Processors/6502Mk2/6502Mk2.hpp"
 #include "Machines/Atari/2600/Bus.hpp"
 
 namespace Atari2600::Cartridge {
 
-class BusExtender: public CPU::MOS6502::BusHandler {
+class BusExtender {
 public:
 	BusExtender(const uint8_t *const rom_base, const std::size_t rom_size) :
 		rom_base_(rom_base), rom_size_(rom_size) {}
@@ -26,7 +26,6 @@ protected:
 };
 
 template<class T> class Cartridge:
-	public CPU::MOS6502::BusHandler,
 	public Bus {
 
 public:
@@ -55,14 +54,11 @@ public:
 			confidence_counter.add_miss();
 	}
 
-	void set_reset_line(const bool state) override	{ m6502_.set_reset_line(state);	}
+	void set_reset_line(const bool state) override	{ m6502_.template set<CPU::MOS6502Mk2::Line::Reset>(state);	}
 
-	// to satisfy CPU::MOS6502::Processor
-	Cycles perform_bus_operation(
-		const CPU::MOS6502::BusOperation operation,
-		const uint16_t address,
-		uint8_t *const value
-	) {
+	// to satisfy CPU::MOS6502Mk2::Processor
+	template <CPU::MOS6502Mk2::BusOperation operation, typename AddressT>
+	Cycles perform(const AddressT address, CPU::MOS6502Mk2::data_t<operation> value) {
 		uint8_t returnValue = 0xff;
 		int cycles_run_for = 3;
 
@@ -70,7 +66,7 @@ public:
 		// leap to the end of ready only once ready is signalled because on a 6502 ready doesn't take
 		// effect until the next read; therefore it isn't safe to assume that signalling ready immediately
 		// skips to the end of the line.
-		if(operation == CPU::MOS6502::BusOperation::Ready)
+		if constexpr (operation == CPU::MOS6502Mk2::BusOperation::Ready)
 			cycles_run_for = tia_.get_cycles_until_horizontal_blank(cycles_since_video_update_);
 
 		cycles_since_speaker_update_ += Cycles(cycles_run_for);
@@ -78,22 +74,26 @@ public:
 		cycles_since_6532_update_ += Cycles(cycles_run_for / 3);
 		bus_extender_.advance_cycles(cycles_run_for / 3);
 
-		if(is_access(operation)) {
-			// give the cartridge a chance to respond to the bus access
-			bus_extender_.perform_bus_operation(operation, address, value);
+		if constexpr (is_access(operation)) {
+			// give the cartridge a chance to respond to the bus access; reads begin with an undriven bus
+			uint8_t data = 0xff;
+			if constexpr (is_write(operation)) {
+				data = value;
+			}
+			bus_extender_.perform_bus_operation(operation, address, &data);
 
 			// check for a RIOT RAM access
 			if((address&0x1280) == 0x80) {
-				if(is_read(operation)) {
+				if constexpr (is_read(operation)) {
 					returnValue &= mos6532_.get_ram(address);
 				} else {
-					mos6532_.set_ram(address, *value);
+					mos6532_.set_ram(address, data);
 				}
 			}
 
 			// check for a TIA access
 			if(!(address&0x1080)) {
-				if(is_read(operation)) {
+				if constexpr (is_read(operation)) {
 					const uint16_t decodedAddress = address & 0xf;
 					switch(decodedAddress) {
 						case 0x00:		// missile 0 / player collisions
@@ -123,10 +123,10 @@ public:
 				} else {
 					const uint16_t decodedAddress = address & 0x3f;
 					switch(decodedAddress) {
-						case 0x00:	update_video(); tia_.set_sync(*value & 0x02);		break;
-						case 0x01:	update_video();	tia_.set_blank(*value & 0x02);		break;
+						case 0x00:	update_video(); tia_.set_sync(data & 0x02);		break;
+						case 0x01:	update_video();	tia_.set_blank(data & 0x02);		break;
 
-						case 0x02:	m6502_.set_ready_line(true);						break;
+						case 0x02:	m6502_.template set<CPU::MOS6502Mk2::Line::Ready>(true);	break;
 						case 0x03:
 							update_video();
 							tia_.reset_horizontal_counter();
@@ -135,47 +135,47 @@ public:
 							// TODO: audio will now be out of synchronisation. Fix.
 
 						case 0x04:
-						case 0x05:	update_video();	tia_.set_player_number_and_size(decodedAddress - 0x04, *value);	break;
+						case 0x05:	update_video();	tia_.set_player_number_and_size(decodedAddress - 0x04, data);	break;
 						case 0x06:
-						case 0x07:	update_video();	tia_.set_player_missile_colour(decodedAddress - 0x06, *value);		break;
-						case 0x08:	update_video();	tia_.set_playfield_ball_colour(*value);								break;
-						case 0x09:	update_video();	tia_.set_background_colour(*value);									break;
-						case 0x0a:	update_video();	tia_.set_playfield_control_and_ball_size(*value);					break;
+						case 0x07:	update_video();	tia_.set_player_missile_colour(decodedAddress - 0x06, data);		break;
+						case 0x08:	update_video();	tia_.set_playfield_ball_colour(data);								break;
+						case 0x09:	update_video();	tia_.set_background_colour(data);									break;
+						case 0x0a:	update_video();	tia_.set_playfield_control_and_ball_size(data);					break;
 						case 0x0b:
-						case 0x0c:	update_video();	tia_.set_player_reflected(decodedAddress - 0x0b, !((*value)&8));	break;
+						case 0x0c:	update_video();	tia_.set_player_reflected(decodedAddress - 0x0b, !(data&8));	break;
 						case 0x0d:
 						case 0x0e:
-						case 0x0f:	update_video();	tia_.set_playfield(decodedAddress - 0x0d, *value);					break;
+						case 0x0f:	update_video();	tia_.set_playfield(decodedAddress - 0x0d, data);					break;
 						case 0x10:
 						case 0x11:	update_video(); tia_.set_player_position(decodedAddress - 0x10);					break;
 						case 0x12:
 						case 0x13:	update_video(); tia_.set_missile_position(decodedAddress - 0x12);					break;
 						case 0x14:	update_video();	tia_.set_ball_position();											break;
 						case 0x1b:
-						case 0x1c:	update_video(); tia_.set_player_graphic(decodedAddress - 0x1b, *value);				break;
+						case 0x1c:	update_video(); tia_.set_player_graphic(decodedAddress - 0x1b, data);				break;
 						case 0x1d:
-						case 0x1e:	update_video(); tia_.set_missile_enable(decodedAddress - 0x1d, (*value)&2);			break;
-						case 0x1f:	update_video(); tia_.set_ball_enable((*value)&2);									break;
+						case 0x1e:	update_video(); tia_.set_missile_enable(decodedAddress - 0x1d, data&2);			break;
+						case 0x1f:	update_video(); tia_.set_ball_enable(data&2);									break;
 						case 0x20:
-						case 0x21:	update_video(); tia_.set_player_motion(decodedAddress - 0x20, *value);				break;
+						case 0x21:	update_video(); tia_.set_player_motion(decodedAddress - 0x20, data);				break;
 						case 0x22:
-						case 0x23:	update_video(); tia_.set_missile_motion(decodedAddress - 0x22, *value);				break;
-						case 0x24:	update_video(); tia_.set_ball_motion(*value);										break;
+						case 0x23:	update_video(); tia_.set_missile_motion(decodedAddress - 0x22, data);				break;
+						case 0x24:	update_video(); tia_.set_ball_motion(data);										break;
 						case 0x25:
-						case 0x26:	tia_.set_player_delay(decodedAddress - 0x25, (*value)&1);							break;
-						case 0x27:	tia_.set_ball_delay((*value)&1);													break;
+						case 0x26:	tia_.set_player_delay(decodedAddress - 0x25, data&1);							break;
+						case 0x27:	tia_.set_ball_delay(data&1);													break;
 						case 0x28:
-						case 0x29:	update_video(); tia_.set_missile_position_to_player(decodedAddress - 0x28, (*value)&2);		break;
+						case 0x29:	update_video(); tia_.set_missile_position_to_player(decodedAddress - 0x28, data&2);		break;
 						case 0x2a:	update_video(); tia_.move();														break;
 						case 0x2b:	update_video(); tia_.clear_motion();												break;
 						case 0x2c:	update_video(); tia_.clear_collision_flags();										break;
 
 						case 0x15:
-						case 0x16:	update_audio(); tia_sound_.set_control(decodedAddress - 0x15, *value);				break;
+						case 0x16:	update_audio(); tia_sound_.set_control(decodedAddress - 0x15, data);				break;
 						case 0x17:
-						case 0x18:	update_audio(); tia_sound_.set_divider(decodedAddress - 0x17, *value);				break;
+						case 0x18:	update_audio(); tia_sound_.set_divider(decodedAddress - 0x17, data);				break;
 						case 0x19:
-						case 0x1a:	update_audio(); tia_sound_.set_volume(decodedAddress - 0x19, *value);				break;
+						case 0x1a:	update_audio(); tia_sound_.set_volume(decodedAddress - 0x19, data);				break;
 					}
 				}
 			}
@@ -183,19 +183,19 @@ public:
 			// check for a PIA access
 			if((address&0x1280) == 0x280) {
 				update_6532();
-				if(is_read(operation)) {
+				if constexpr (is_read(operation)) {
 					returnValue &= mos6532_.read(address);
 				} else {
-					mos6532_.write(address, *value);
+					mos6532_.write(address, data);
 				}
 			}
 
-			if(is_read(operation)) {
-				*value &= returnValue;
+			if constexpr (is_read(operation)) {
+				value = data & returnValue;
 			}
 		}
 
-		if(!tia_.get_cycles_until_horizontal_blank(cycles_since_video_update_)) m6502_.set_ready_line(false);
+		if(!tia_.get_cycles_until_horizontal_blank(cycles_since_video_update_)) m6502_.template set<CPU::MOS6502Mk2::Line::Ready>(false);
 
 		return Cycles(cycles_run_for / 3);
 	}
@@ -207,7 +207,12 @@ public:
 	}
 
 protected:
-	CPU::MOS6502::Processor<CPU::MOS6502::Personality::P6502, Cartridge<T>, true> m6502_;
+	struct M6502Traits {
+		static constexpr auto uses_ready_line = true;
+		static constexpr auto pause_precision = CPU::MOS6502Mk2::PausePrecision::AnyCycle;
+		using BusHandlerT = Cartridge<T>;
+	};
+	CPU::MOS6502Mk2::Processor<CPU::MOS6502Mk2::Model::M6502, M6502Traits> m6502_;
 	std::vector<uint8_t> rom_;
 
 private:
@@ -20,7 +20,7 @@ public:
 	}
 
 	void perform_bus_operation(
-		const CPU::MOS6502::BusOperation operation,
+		const CPU::MOS6502Mk2::BusOperation operation,
 		const uint16_t address,
 		uint8_t *const value
 	) {
@@ -11,32 +11,50 @@
 using namespace Atari2600;
 
 Atari2600::TIASound::TIASound(Concurrency::AsyncTaskQueue<false> &audio_queue) :
-	audio_queue_(audio_queue)
+	writes_(*this, audio_queue)
 {}
 
 void Atari2600::TIASound::set_volume(const int channel, const uint8_t volume) {
-	audio_queue_.enqueue([target = &volume_[channel], volume]() {
-		*target = volume & 0xf;
-	});
+	writes_.push(Write{Write::Register::Volume, uint8_t(channel), volume});
 }
 
 void Atari2600::TIASound::set_divider(const int channel, const uint8_t divider) {
-	audio_queue_.enqueue([this, channel, divider]() {
-		divider_[channel] = divider & 0x1f;
-		divider_counter_[channel] = 0;
-	});
+	writes_.push(Write{Write::Register::Divider, uint8_t(channel), divider});
 }
 
 void Atari2600::TIASound::set_control(const int channel, const uint8_t control) {
-	audio_queue_.enqueue([target = &control_[channel], control]() {
-		*target = control & 0xf;
-	});
+	writes_.push(Write{Write::Register::Control, uint8_t(channel), control});
+}
+
+void Atari2600::TIASound::apply(const Write &write) {
+	switch(write.target) {
+		case Write::Register::Volume:
+			volume_[write.channel] = write.value & 0xf;
+		break;
+		case Write::Register::Divider:
+			divider_[write.channel] = write.value & 0x1f;
+			divider_counter_[write.channel] = 0;
+		break;
+		case Write::Register::Control:
+			control_[write.channel] = write.value & 0xf;
+		break;
+	}
 }
 
 template <Outputs::Speaker::Action action>
 void Atari2600::TIASound::apply_samples(
 	const std::size_t number_of_samples,
 	Outputs::Speaker::MonoSample *const target
+) {
+	writes_.generate(number_of_samples, target, [&](const std::size_t length, Outputs::Speaker::MonoSample *const segment) {
+		generate_samples<action>(length, segment);
+	});
+}
+
+template <Outputs::Speaker::Action action>
+void Atari2600::TIASound::generate_samples(
+	const std::size_t number_of_samples,
+	Outputs::Speaker::MonoSample *const target
 ) {
 	const auto advance_poly4 = [&](const int channel) {
 		poly4_counter_[channel] =
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Outputs/Speaker/Implementation/BufferSource.hpp"
+#include "Outputs/Speaker/Implementation/RegisterWriteLog.hpp"
 #include "Concurrency/AsyncTaskQueue.hpp"
 
 namespace Atari2600 {
@@ -28,9 +29,22 @@ public:
 	// To satisfy ::SampleSource.
 	template <Outputs::Speaker::Action action> void apply_samples(std::size_t, Outputs::Speaker::MonoSample *);
 	void set_sample_volume_range(std::int16_t);
+	void will_run_for(const Cycles cycles) {	writes_.will_run_for(cycles);	}
+	void did_run_for(const Cycles cycles) {		writes_.did_run_for(cycles);	}
 
 private:
-	Concurrency::AsyncTaskQueue<false> &audio_queue_;
+	struct Write {
+		enum class Register: uint8_t {
+			Volume, Divider, Control
+		} target;
+		uint8_t channel;
+		uint8_t value;
+	};
+	friend Outputs::Speaker::RegisterWriteLog<TIASound, Write>;
+	Outputs::Speaker::RegisterWriteLog<TIASound, Write> writes_;
+	void apply(const Write &);
+
+	template <Outputs::Speaker::Action action> void generate_samples(std::size_t, Outputs::Speaker::MonoSample *);
 
 	uint8_t volume_[2];
 	uint8_t divider_[2];
@@ -699,12 +699,14 @@ private:
 	std::unique_ptr<Reflection::Struct> get_options() const final {
 		auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 		options->output = get_video_signal_configurable();
+		options->fast_sector_search = dma_.get()->get_is_fast_sector_search();
 		return options;
 	}
 
 	void set_options(const std::unique_ptr<Reflection::Struct> &str) final {
 		const auto options = dynamic_cast<Options *>(str.get());
 		set_video_signal_configurable(options->output);
+		dma_->set_is_fast_sector_search(options->fast_sector_search);
 	}
 };
 
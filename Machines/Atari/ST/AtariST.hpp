@@ -22,12 +22,19 @@ struct Machine {
 
 	static std::unique_ptr<Machine> create(const Analyser::Static::Target &, const ROMMachine::ROMFetcher &);
 
-	class Options: public Reflection::StructImpl<Options>, public Configurable::Options::Display<Options> {
+	class Options:
+		public Reflection::StructImpl<Options>,
+		public Configurable::Options::Display<Options>,
+		public Configurable::Options::FastSectorSearch<Options>
+	{
 		friend Configurable::Options::Display<Options>;
+		friend Configurable::Options::FastSectorSearch<Options>;
 	public:
-		Options(const Configurable::OptionsType type) : Configurable::Options::Display<Options>(
-			type == Configurable::OptionsType::UserFriendly ?
-				Configurable::Display::RGB : Configurable::Display::CompositeColour) {}
+		Options(const Configurable::OptionsType type) :
+			Configurable::Options::Display<Options>(
+				type == Configurable::OptionsType::UserFriendly ?
+					Configurable::Display::RGB : Configurable::Display::CompositeColour),
+			Configurable::Options::FastSectorSearch<Options>(false) {}
 
 	private:
 		Options() : Options(Configurable::OptionsType::UserFriendly) {}
@@ -35,6 +42,7 @@ struct Machine {
 		friend Reflection::StructImpl<Options>;
 		void declare_fields() {
 			declare_display_option();
+			declare_fast_sector_search_option();
 			limit_enum(&output, Configurable::Display::RGB, Configurable::Display::CompositeColour, -1);
 		}
 	};
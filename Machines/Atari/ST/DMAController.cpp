@@ -247,3 +247,11 @@ ClockingHint::Preference DMAController::preferred_clocking() const {
 void DMAController::set_activity_observer(Activity::Observer *observer) {
 	fdc_.set_activity_observer(observer);
 }
+
+void DMAController::set_is_fast_sector_search(const bool is_fast_sector_search) {
+	fdc_.set_is_fast_sector_search(is_fast_sector_search);
+}
+
+bool DMAController::get_is_fast_sector_search() const {
+	return fdc_.get_is_fast_sector_search();
+}
@@ -47,6 +47,10 @@ public:
 
 	void set_activity_observer(Activity::Observer *observer);
 
+	/// Enables or disables fast sector searches, as per @c Storage::Disk::MFMController.
+	void set_is_fast_sector_search(bool);
+	bool get_is_fast_sector_search() const;
+
 	// ClockingHint::Source.
 	ClockingHint::Preference preferred_clocking() const final;
 
@@ -118,6 +118,7 @@ class ConcreteMachine:
 public:
 	ConcreteMachine(const Analyser::Static::Target &target, const ROMMachine::ROMFetcher &rom_fetcher) :
 		z80_(*this),
+		vdp_(VDPHandOffThreshold, VDPMaximumLag),
 		sn76489_(TI::SN76489::Personality::SN76489, audio_queue_, sn76489_divider),
 		ay_(GI::AY38910::Personality::AY38910, audio_queue_),
 		mixer_(sn76489_, ay_),
@@ -176,19 +177,19 @@ public:
 	}
 
 	void set_scan_target(Outputs::Display::ScanTarget *scan_target) final {
-		vdp_.get()->set_scan_target(scan_target);
+		vdp_->set_scan_target(scan_target);
 	}
 
 	Outputs::Display::ScanStatus get_scaled_scan_status() const final {
-		return vdp_.get()->get_scaled_scan_status();
+		return vdp_->get_scaled_scan_status();
 	}
 
 	void set_display_type(Outputs::Display::DisplayType display_type) final {
-		vdp_.get()->set_display_type(display_type);
+		vdp_->set_display_type(display_type);
 	}
 
 	Outputs::Display::DisplayType get_display_type() const final {
-		return vdp_.get()->get_display_type();
+		return vdp_->get_display_type();
 	}
 
 	Outputs::Speaker::Speaker *get_speaker() final {
@@ -386,7 +387,13 @@ private:
 	}
 
 	CPU::Z80::Processor<ConcreteMachine, false, false> z80_;
-	JustInTimeActor<TI::TMS::TMS9918<TI::TMS::Personality::TMS9918A>> vdp_;
+
+	// The VDP has its own RAM and is otherwise accessed only via its ports, so it can run on
+	// a separate thread. Time is handed off once a few lines' worth has accumulated, and the
+	// machine will wait if the VDP falls more than a frame behind.
+	static constexpr HalfCycles VDPHandOffThreshold = HalfCycles(228 * 2 * 8);
+	static constexpr HalfCycles VDPMaximumLag = HalfCycles(228 * 2 * 262);
+	AsyncJustInTimeActor<TI::TMS::TMS9918<TI::TMS::Personality::TMS9918A>> vdp_;
 
 	Concurrency::AsyncTaskQueue<false> audio_queue_;
 	TI::SN76489 sn76489_;
@@ -76,6 +76,15 @@ Cycles MachineBase::perform(const AddressT address, CPU::MOS6502Mk2::data_t<oper
 			0x1c00-0x1c0f	the drive VIA
 			0xc000-0xffff	ROM
 	*/
+
+	// The disk is clocked in arrears, catching up at each instruction boundary and before
+	// any access to the drive VIA, which is both how the CPU observes the disk and how it
+	// changes the motor, head and shifter. Overflow therefore reaches the CPU no later
+	// than the start of the next instruction.
+	if(operation == CPU::MOS6502Mk2::BusOperation::ReadOpcode || (address >= 0x1c00 && address <= 0x1c0f)) {
+		run_disk();
+	}
+
 	if(address < 0x800) {
 		if constexpr (is_read(operation))
 			value = ram_[address];
@@ -104,14 +113,22 @@ Cycles MachineBase::perform(const AddressT address, CPU::MOS6502Mk2::data_t<oper
 	serial_port_VIA_.run_for(Cycles(1));
 	drive_VIA_.run_for(Cycles(1));
 
+	++disk_cycles_;
+
 	return Cycles(1);
 }
 
+void MachineBase::run_disk() {
+	// The motor can change only via the drive VIA, so it has been in its current state
+	// throughout the period being caught up on.
+	if(disk_cycles_ > Cycles(0) && get_drive().get_motor_on()) {
+		Storage::Disk::Controller::run_for(disk_cycles_);
+	}
+	disk_cycles_ = Cycles(0);
+}
+
 void Machine::run_for(const Cycles cycles) {
 	m6502_.run_for(cycles);
-	if(get_drive().get_motor_on()) {
-		Storage::Disk::Controller::run_for(cycles);
-	}
 }
 
 // MARK: - External attachments.
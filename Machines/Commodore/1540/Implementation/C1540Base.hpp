@@ -140,7 +140,7 @@ public:
 	/// Attaches the activity observer to this C1540.
 	void set_activity_observer(Activity::Observer *);
 
-	// to satisfy CPU::MOS6502::Processor
+	// to satisfy CPU::MOS6502Mk2::Processor
 	template <CPU::MOS6502Mk2::BusOperation operation, typename AddressT>
 	Cycles perform(const AddressT, CPU::MOS6502Mk2::data_t<operation>);
 
@@ -163,6 +163,10 @@ protected:
 	};
 	CPU::MOS6502Mk2::Processor<CPU::MOS6502Mk2::Model::M6502, M6502Traits> m6502_;
 
+	/// Runs the disk controller for the time accrued since it was last run.
+	void run_disk();
+	Cycles disk_cycles_;
+
 	uint8_t ram_[0x800];
 	uint8_t rom_[0x4000];
 
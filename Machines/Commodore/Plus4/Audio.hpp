@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Outputs/Speaker/Implementation/BufferSource.hpp"
+#include "Outputs/Speaker/Implementation/RegisterWriteLog.hpp"
 #include "Concurrency/AsyncTaskQueue.hpp"
 
 namespace Commodore::Plus4 {
@@ -16,10 +17,93 @@ namespace Commodore::Plus4 {
 class Audio: public Outputs::Speaker::BufferSource<Audio, false> {
 public:
 	Audio(Concurrency::AsyncTaskQueue<false> &audio_queue) :
-		audio_queue_(audio_queue) {}
+		writes_(*this, audio_queue) {}
 
 	template <Outputs::Speaker::Action action>
-	void apply_samples(std::size_t size, Outputs::Speaker::MonoSample *const target) {
+	void apply_samples(const std::size_t size, Outputs::Speaker::MonoSample *const target) {
+		writes_.generate(size, target, [&](const std::size_t length, Outputs::Speaker::MonoSample *const segment) {
+			generate_samples<action>(length, segment);
+		});
+	}
+
+	void will_run_for(const Cycles cycles) {	writes_.will_run_for(cycles);	}
+	void did_run_for(const Cycles cycles) {		writes_.did_run_for(cycles);	}
+
+	void set_sample_volume_range(const std::int16_t range) {
+		external_volume_ = range; // / (2 * 9);	// Two channels and nine output levels.
+	}
+
+	bool is_zero_level() const {
+		return !(channels_[0].enabled || channels_[1].enabled || sound2_noise_on_) || !volume_;
+	}
+
+	template <int channel> void set_frequency_low(const uint8_t value) {
+		writes_.push(Write{Write::Register::FrequencyLow, channel, value});
+	}
+
+	template <int channel> void set_frequency_high(const uint8_t value) {
+		writes_.push(Write{Write::Register::FrequencyHigh, channel, value});
+	}
+
+	void set_control(const uint8_t value) {
+		writes_.push(Write{Write::Register::Control, 0, value});
+	}
+
+	void set_divider(const uint8_t value) {
+		writes_.push(Write{Write::Register::Divider, 0, value});
+	}
+
+private:
+	// Calling-thread state; writes are applied on the audio thread.
+	struct Write {
+		enum class Register: uint8_t {
+			FrequencyLow, FrequencyHigh, Control, Divider,
+		} target;
+		uint8_t channel;
+		uint8_t value;
+	};
+	friend Outputs::Speaker::RegisterWriteLog<Audio, Write>;
+	Outputs::Speaker::RegisterWriteLog<Audio, Write> writes_;
+
+	void apply(const Write &write) {
+		const auto [target, channel, value] = write;
+		switch(target) {
+			case Write::Register::FrequencyLow:
+				channels_[channel].frequency = (channels_[channel].frequency & 0xff00) | value;
+			break;
+
+			case Write::Register::FrequencyHigh:
+				channels_[channel].frequency = (channels_[channel].frequency & 0x00ff) | ((value&3) << 8);
+			break;
+
+			case Write::Register::Control:
+				switch(value & 0xf) {
+					case 0:		volume_ = 31;	break;
+					case 1:		volume_ = 30;	break;
+					case 2:		volume_ = 28;	break;
+					case 3:		volume_ = 26;	break;
+					case 4:		volume_ = 24;	break;
+					case 5:		volume_ = 22;	break;
+					case 6:		volume_ = 20;	break;
+					case 7:		volume_ = 18;	break;
+					default:	volume_ = 16;	break;
+				}
+				volume_ = std::min(value & 0xf, 8);	// Only nine volumes are available.
+				channels_[0].enabled = (value & 0x10) ? 1 : 0;
+				channels_[1].enabled = (value & 0x20) ? 1 : 0;
+				sound2_noise_on_ = (value & 0x40) && !(value & 0x20);
+
+				sound_dc_ = value & 0x80;
+			break;
+
+			case Write::Register::Divider:
+				frequency_multiplier_ = 32 * (value & 0x40 ? 4 : 5);
+			break;
+		}
+	}
+
+	template <Outputs::Speaker::Action action>
+	void generate_samples(const std::size_t size, Outputs::Speaker::MonoSample *const target) {
 		// Divide by frequency_multiplier_ and multiply by 8 to get the "8Mhz clock".
 		// Each 32-window cycle of that clock is a single complete tick of the audio engine.
 
@@ -72,58 +156,6 @@ public:
 		}
 	}
 
-	void set_sample_volume_range(const std::int16_t range) {
-		external_volume_ = range; // / (2 * 9);	// Two channels and nine output levels.
-	}
-
-	bool is_zero_level() const {
-		return !(channels_[0].enabled || channels_[1].enabled || sound2_noise_on_) || !volume_;
-	}
-
-	template <int channel> void set_frequency_low(uint8_t value) {
-		audio_queue_.enqueue([this, value] {
-			channels_[channel].frequency = (channels_[channel].frequency & 0xff00) | value;
-		});
-	}
-
-	template <int channel> void set_frequency_high(uint8_t value) {
-		audio_queue_.enqueue([this, value] {
-			channels_[channel].frequency = (channels_[channel].frequency & 0x00ff) | ((value&3) << 8);
-		});
-	}
-
-	void set_control(const uint8_t value) {
-		audio_queue_.enqueue([this, value] {
-			switch(value & 0xf) {
-				case 0:		volume_ = 31;	break;
-				case 1:		volume_ = 30;	break;
-				case 2:		volume_ = 28;	break;
-				case 3:		volume_ = 26;	break;
-				case 4:		volume_ = 24;	break;
-				case 5:		volume_ = 22;	break;
-				case 6:		volume_ = 20;	break;
-				case 7:		volume_ = 18;	break;
-				default:	volume_ = 16;	break;
-			}
-			volume_ = std::min(value & 0xf, 8);	// Only nine volumes are available.
-			channels_[0].enabled = (value & 0x10) ? 1 : 0;
-			channels_[1].enabled = (value & 0x20) ? 1 : 0;
-			sound2_noise_on_ = (value & 0x40) && !(value & 0x20);
-
-			sound_dc_ = value & 0x80;
-		});
-	}
-
-	void set_divider(const uint8_t value) {
-		audio_queue_.enqueue([this, value] {
-			frequency_multiplier_ = 32 * (value & 0x40 ? 4 : 5);
-		});
-	}
-
-private:
-	// Calling-thread state.
-	Concurrency::AsyncTaskQueue<false> &audio_queue_;
-
 	// Audio-thread state.
 	int16_t external_volume_ = 0;
 	int frequency_multiplier_ = 5;
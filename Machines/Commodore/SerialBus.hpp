@@ -89,6 +89,7 @@ public:
 	*/
 	void set_output(Line line, LineLevel level) {
 		if(line_levels_[size_t(line)] != level) {
+			will_change_output(line);
 			line_levels_[size_t(line)] = level;
 			if(serial_bus_) serial_bus_->set_line_output_did_change(line);
 		}
@@ -106,6 +107,12 @@ public:
 	*/
 	virtual void set_input(Line, LineLevel) = 0;
 
+	/*!
+		Called immediately before a change in level of an output line is communicated to the bus. Subclasses
+		may use this to bring any devices that they clock lazily up to date before they observe the change.
+	*/
+	virtual void will_change_output(Line) {}
+
 	/*!
 		Sets the supplied serial bus as that to which line levels will be communicated.
 	*/
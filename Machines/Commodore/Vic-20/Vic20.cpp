@@ -210,18 +210,33 @@ private:
 */
 class SerialPort : public ::Commodore::Serial::Port {
 public:
+	struct Delegate {
+		virtual void serial_port_will_change_output(SerialPort &) = 0;
+	};
+
 	/// Receives an input change from the base serial port class, and communicates it to the user-port VIA.
 	void set_input(const ::Commodore::Serial::Line line, const ::Commodore::Serial::LineLevel level) {
 		if(user_port_via_) user_port_via_->set_serial_line_state(line, bool(level));
 	}
 
+	/// Gives the delegate an opportunity to catch up anything on the bus before an output change is seen.
+	void will_change_output(::Commodore::Serial::Line) final {
+		if(delegate_) delegate_->serial_port_will_change_output(*this);
+	}
+
 	/// Sets the user-port VIA with which this serial port communicates.
 	void set_user_port_via(UserPortVIA &via) {
 		user_port_via_ = &via;
 	}
 
+	/// Sets the delegate to notify of impending output changes.
+	void set_delegate(Delegate *const delegate) {
+		delegate_ = delegate;
+	}
+
 private:
 	UserPortVIA *user_port_via_ = nullptr;
+	Delegate *delegate_ = nullptr;
 };
 
 /*!
@@ -290,6 +305,7 @@ class ConcreteMachine:
 	public Storage::Tape::BinaryTapePlayer::Delegate,
 	public Machine,
 	public ClockingHint::Observer,
+	public SerialPort::Delegate,
 	public Activity::Source {
 public:
 	ConcreteMachine(const Analyser::Static::Commodore::Vic20Target &target, const ROMMachine::ROMFetcher &rom_fetcher) :
@@ -363,8 +379,10 @@ public:
 			// construct the 1540
 			c1540_ = std::make_unique<C1540::Machine>(C1540::Personality::C1540, roms);
 
-			// attach it to the serial bus
+			// attach it to the serial bus; it'll be run lazily, so needs to be brought up to date
+			// whenever the Vic is about to change what it outputs to the bus
 			c1540_->set_serial_bus(serial_bus_);
+			serial_port_.set_delegate(this);
 
 			// give it a little warm up
 			c1540_->run_for(Cycles(2000000));
@@ -510,7 +528,11 @@ public:
 					update_video();
 					result &= mos6560_.read(address);
 				}
-				if(address & 0x10) result &= user_port_via_.read(address);
+				if(address & 0x10) {
+					// The user-port VIA reads the serial bus, so the drive needs to be current.
+					update_c1540();
+					result &= user_port_via_.read(address);
+				}
 				if(address & 0x20) result &= keyboard_via_.read(address);
 
 				if(!is_from_rom()) {
@@ -632,7 +654,7 @@ public:
 			}
 		}
 		if(!tape_is_sleeping_ && !hold_tape_) tape_->run_for(Cycles(1));
-		if(c1540_) c1540_->run_for(Cycles(1));
+		++cycles_since_c1540_update_;
 
 		return Cycles(1);
 	}
@@ -648,6 +670,7 @@ public:
 
 	void run_for(const Cycles cycles) final {
 		m6502_.run_for(cycles);
+		update_c1540();
 	}
 
 	void set_scan_target(Outputs::Display::ScanTarget *const scan_target) final {
@@ -728,6 +751,16 @@ private:
 		mos6560_.run_for(cycles_since_mos6560_update_.flush<Cycles>());
 	}
 
+	// The C1540, if attached, is run only when something might observe it: before any change of the
+	// Vic's serial outputs, before the user-port VIA is read and at the end of every run_for.
+	void update_c1540() {
+		const auto cycles = cycles_since_c1540_update_.flush<Cycles>();
+		if(c1540_) c1540_->run_for(cycles);
+	}
+	void serial_port_will_change_output(SerialPort &) final {
+		update_c1540();
+	}
+
 	std::vector<uint8_t> character_rom_;
 	std::vector<uint8_t> basic_rom_;
 	std::vector<uint8_t> kernel_rom_;
@@ -802,6 +835,7 @@ private:
 
 	// Disk
 	std::unique_ptr<::Commodore::C1540::Machine> c1540_;
+	Cycles cycles_since_c1540_update_;
 
 	// MARK: - Confidence.
 	Analyser::Dynamic::ConfidenceCounter confidence_;
@@ -13,53 +13,55 @@ using namespace Enterprise::Dave;
 // MARK: - Audio generator
 
 Audio::Audio(Concurrency::AsyncTaskQueue<false> &audio_queue) :
-	audio_queue_(audio_queue) {}
+	audio_queue_(audio_queue), writes_(*this, audio_queue) {}
 
-void Audio::write(uint16_t address, const uint8_t value) {
-	address &= 0x1f;
-	audio_queue_.enqueue([address, value, this] {
-		switch(address) {
-			case 0:	case 2:	case 4:
-				channels_[address >> 1].reload = (channels_[address >> 1].reload & 0xff00) | value;
-			break;
-			case 1:	case 3:	case 5:
-				channels_[address >> 1].reload = uint16_t((channels_[address >> 1].reload & 0x00ff) | ((value & 0xf) << 8));
-				channels_[address >> 1].distortion = Channel::Distortion((value >> 4)&3);
-				channels_[address >> 1].high_pass = value & 0x40;
-				channels_[address >> 1].ring_modulate = value & 0x80;
-			break;
-			case 6:
-				noise_.frequency = Noise::Frequency(value&3);
-				noise_.polynomial = Noise::Polynomial((value >> 2)&3);
-				noise_.swap_polynomial = value & 0x10;
-				noise_.low_pass = value & 0x20;
-				noise_.high_pass = value & 0x40;
-				noise_.ring_modulate = value & 0x80;
-			break;
-
-			case 7:
-				channels_[0].sync = value & 0x01;
-				channels_[1].sync = value & 0x02;
-				channels_[2].sync = value & 0x04;
-				use_direct_output_[0] = value & 0x08;
-				use_direct_output_[1] = value & 0x10;
-				// Interrupt bits are handled separately.
-			break;
-
-			case 8: case 9: case 10:
-				channels_[address - 8].amplitude[0] = value & 0x3f;
-			break;
-			case 12: case 13: case 14:
-				channels_[address - 12].amplitude[1] = value & 0x3f;
-			break;
-			case 11:	noise_.amplitude[0] = value & 0x3f;		break;
-			case 15:	noise_.amplitude[1] = value & 0x3f;		break;
-
-			case 31:
-				global_divider_reload_ = 2 + ((value >> 1)&1);
-			break;
-		}
-	});
+void Audio::write(const uint16_t address, const uint8_t value) {
+	writes_.push(Write{uint8_t(address & 0x1f), value});
+}
+
+void Audio::apply(const Write &write) {
+	const auto [address, value] = write;
+	switch(address) {
+		case 0:	case 2:	case 4:
+			channels_[address >> 1].reload = (channels_[address >> 1].reload & 0xff00) | value;
+		break;
+		case 1:	case 3:	case 5:
+			channels_[address >> 1].reload = uint16_t((channels_[address >> 1].reload & 0x00ff) | ((value & 0xf) << 8));
+			channels_[address >> 1].distortion = Channel::Distortion((value >> 4)&3);
+			channels_[address >> 1].high_pass = value & 0x40;
+			channels_[address >> 1].ring_modulate = value & 0x80;
+		break;
+		case 6:
+			noise_.frequency = Noise::Frequency(value&3);
+			noise_.polynomial = Noise::Polynomial((value >> 2)&3);
+			noise_.swap_polynomial = value & 0x10;
+			noise_.low_pass = value & 0x20;
+			noise_.high_pass = value & 0x40;
+			noise_.ring_modulate = value & 0x80;
+		break;
+
+		case 7:
+			channels_[0].sync = value & 0x01;
+			channels_[1].sync = value & 0x02;
+			channels_[2].sync = value & 0x04;
+			use_direct_output_[0] = value & 0x08;
+			use_direct_output_[1] = value & 0x10;
+			// Interrupt bits are handled separately.
+		break;
+
+		case 8: case 9: case 10:
+			channels_[address - 8].amplitude[0] = value & 0x3f;
+		break;
+		case 12: case 13: case 14:
+			channels_[address - 12].amplitude[1] = value & 0x3f;
+		break;
+		case 11:	noise_.amplitude[0] = value & 0x3f;		break;
+		case 15:	noise_.amplitude[1] = value & 0x3f;		break;
+
+		case 31:
+			global_divider_reload_ = 2 + ((value >> 1)&1);
+		break;
+	}
 }
 
 void Audio::set_sample_volume_range(const int16_t range) {
@@ -101,6 +103,13 @@ void Audio::update_channel(const int c) {
 
 template <Outputs::Speaker::Action action>
 void Audio::apply_samples(const std::size_t number_of_samples, Outputs::Speaker::StereoSample *const target) {
+	writes_.generate(number_of_samples, target, [&](const std::size_t length, Outputs::Speaker::StereoSample *const segment) {
+		generate_samples<action>(length, segment);
+	});
+}
+
+template <Outputs::Speaker::Action action>
+void Audio::generate_samples(const std::size_t number_of_samples, Outputs::Speaker::StereoSample *const target) {
 	Outputs::Speaker::StereoSample output_level;
 
 	size_t c = 0;
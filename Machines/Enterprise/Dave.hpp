@@ -14,6 +14,7 @@
 #include "Concurrency/AsyncTaskQueue.hpp"
 #include "Numeric/LFSR.hpp"
 #include "Outputs/Speaker/Implementation/BufferSource.hpp"
+#include "Outputs/Speaker/Implementation/RegisterWriteLog.hpp"
 
 namespace Enterprise::Dave {
 
@@ -39,10 +40,23 @@ public:
 	void set_sample_volume_range(int16_t range);
 	template <Outputs::Speaker::Action action>
 	void apply_samples(std::size_t number_of_samples, Outputs::Speaker::StereoSample *target);
+	void will_run_for(const Cycles cycles) {	writes_.will_run_for(cycles);	}
+	void did_run_for(const Cycles cycles) {		writes_.did_run_for(cycles);	}
 
 private:
 	Concurrency::AsyncTaskQueue<false> &audio_queue_;
 
+	struct Write {
+		uint8_t address;
+		uint8_t value;
+	};
+	friend Outputs::Speaker::RegisterWriteLog<Audio, Write>;
+	Outputs::Speaker::RegisterWriteLog<Audio, Write> writes_;
+	void apply(const Write &);
+
+	template <Outputs::Speaker::Action action>
+	void generate_samples(std::size_t number_of_samples, Outputs::Speaker::StereoSample *target);
+
 	// Global divider (i.e. 8MHz/12Mhz switch).
 	uint8_t global_divider_;
 	uint8_t global_divider_reload_ = 2;
@@ -34,6 +34,7 @@
 
 #include "Activity/Source.hpp"
 #include "Machines/MachineTypes.hpp"
+#include "Machines/Utility/TapeEdgeAccelerator.hpp"
 #include "Configurable/Configurable.hpp"
 
 #include "Outputs/Log.hpp"
@@ -638,6 +639,11 @@ public:
 						case 0xa2:
 							update_audio();
 							*cycle.value = GI::AY38910::Utility::read(speaker_.ay);
+
+							// AY port A, register 14, includes the tape input.
+							if(allow_fast_tape_ && !tape_player_is_sleeping_ && speaker_.ay.get_selected_register() == 14) {
+								tape_edge_accelerator_.did_read_input(z80_, tape_player_);
+							}
 						break;
 
 						case 0xa8:	case 0xa9:
@@ -779,6 +785,8 @@ public:
 
 		if(!tape_player_is_sleeping_) {
 			tape_player_.run_for(cycle.length.reduce<Cycles>());
+			tape_edge_accelerator_.run_for(cycle.length.reduce<Cycles>());
+			tape_edge_accelerator_.did_perform(cycle);
 		}
 
 		return addition;
@@ -821,6 +829,7 @@ public:
 		auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 		options->output = get_video_signal_configurable();
 		options->quick_load = allow_fast_tape_;
+		options->fast_sector_search = allow_fast_sector_search_;
 		return options;
 	}
 
@@ -829,6 +838,12 @@ public:
 		set_video_signal_configurable(options->output);
 		allow_fast_tape_ = options->quick_load;
 		set_use_fast_tape();
+
+		allow_fast_sector_search_ = options->fast_sector_search;
+		DiskROM *const handler = disk_handler();
+		if(handler) {
+			handler->set_is_fast_sector_search(allow_fast_sector_search_);
+		}
 	}
 
 	// MARK: - Sleeper
@@ -923,8 +938,10 @@ private:
 	JustInTimeActor<TI::TMS::TMS9918<vdp_model()>> vdp_;
 
 	Storage::Tape::BinaryTapePlayer tape_player_;
+	Utility::TapeEdgeAccelerator tape_edge_accelerator_;
 	bool tape_player_is_sleeping_ = false;
 	bool allow_fast_tape_ = false;
+	bool allow_fast_sector_search_ = false;
 	bool use_fast_tape_ = false;
 	void set_use_fast_tape() {
 		use_fast_tape_ =
@@ -24,14 +24,17 @@ struct Machine {
 	class Options:
 		public Reflection::StructImpl<Options>,
 		public Configurable::Options::Display<Options>,
-		public Configurable::Options::QuickLoad<Options>
+		public Configurable::Options::QuickLoad<Options>,
+		public Configurable::Options::FastSectorSearch<Options>
 	{
 		friend Configurable::Options::Display<Options>;
 		friend Configurable::Options::QuickLoad<Options>;
+		friend Configurable::Options::FastSectorSearch<Options>;
 	public:
 		Options(const Configurable::OptionsType type) :
 			Configurable::Options::Display<Options>(type == Configurable::OptionsType::UserFriendly ? Configurable::Display::RGB : Configurable::Display::CompositeColour),
-			Configurable::Options::QuickLoad<Options>(type == Configurable::OptionsType::UserFriendly) {}
+			Configurable::Options::QuickLoad<Options>(type == Configurable::OptionsType::UserFriendly),
+			Configurable::Options::FastSectorSearch<Options>(false) {}
 
 	private:
 		Options() : Options(Configurable::OptionsType::UserFriendly) {}
@@ -40,6 +43,7 @@ struct Machine {
 		void declare_fields() {
 			declare_display_option();
 			declare_quickload_option();
+			declare_fast_sector_search_option();
 		}
 	};
 };
@@ -542,7 +542,10 @@ public:
 				if(!is_write(operation))
 					*value = ram_[address];
 				else {
-					if(address >= 0x9800 && address <= 0xc000) video_.flush();
+					if(address >= 0x9800 && address <= 0xc000) {
+						video_.flush();
+						video_.get()->did_write(address);
+					}
 					ram_[address] = *value;
 				}
 			}
@@ -62,6 +62,7 @@ void VideoOutput::set_display_type(Outputs::Display::DisplayType display_type) {
 	if(data_type_ != data_type) {
 		data_type_ = data_type;
 		crt_.set_input_data_type(data_type_);
+		line_cache_.invalidate_all();
 	}
 }
 
@@ -79,6 +80,7 @@ Outputs::Display::ScanStatus VideoOutput::get_scaled_scan_status() const {
 
 void VideoOutput::set_colour_rom(const std::vector<uint8_t> &rom) {
 	has_colour_rom_ = true;
+	line_cache_.invalidate_all();
 
 	const uint8_t xor_mask = 0x4 ^ rom[0];
 
@@ -139,6 +141,25 @@ Cycles VideoOutput::next_sequence_point() const {
 	}
 }
 
+void VideoOutput::did_write(const uint16_t address) {
+	// Character sets; these may affect any line.
+	if((address >= 0x9800 && address < 0xa000) || (address >= 0xb400 && address < 0xbc00)) {
+		line_cache_.invalidate_all();
+		return;
+	}
+
+	// Graphics mode pixels.
+	if(address >= 0xa000 && address < 0xa000 + 200*40) {
+		line_cache_.invalidate((address - 0xa000) / 40);
+	}
+
+	// Text mode characters.
+	if(address >= 0xbb80 && address < 0xbb80 + 28*40) {
+		const size_t row = size_t(address - 0xbb80) / 40;
+		line_cache_.invalidate(row * 8, row * 8 + 8);
+	}
+}
+
 void VideoOutput::run_for(const Cycles cycles) {
 	// Horizontal: 0-39: pixels; otherwise blank; 48-53 sync, 54-56 colour burst.
 	// Vertical: 0-223: pixels; otherwise blank; 256-259 (50Hz) or 234-238 (60Hz) sync.
@@ -163,14 +184,20 @@ void VideoOutput::run_for(const Cycles cycles) {
 				use_alternative_character_set_ = use_double_height_characters_ = blink_text_ = false;
 				set_character_set_base_address();
 
+				// Lines are regenerated if they begin in a different mode from last time.
+				const auto line = size_t(counter_ >> 6);
 				if(data_type_ == Outputs::Display::InputDataType::Red1Green1Blue1) {
-					rgb_pixel_target_ = reinterpret_cast<uint8_t *>(crt_.begin_data(240));
+					rgb_pixel_target_ = line_cache_.begin_line<uint8_t>(line, is_graphics_mode_);
 				} else {
-					composite_pixel_target_ = reinterpret_cast<uint32_t *>(crt_.begin_data(240));
+					composite_pixel_target_ = line_cache_.begin_line<uint32_t>(line, is_graphics_mode_);
 				}
 
 				if(!counter_) {
 					frame_counter_++;
+					if(!(frame_counter_ & 31)) {
+						// Blinking text has changed phase.
+						line_cache_.invalidate_all();
+					}
 
 					v_sync_start_position_ = next_frame_is_sixty_hertz_ ? PAL60VSyncStartPosition : PAL50VSyncStartPosition;
 					v_sync_end_position_ = next_frame_is_sixty_hertz_ ? PAL60VSyncEndPosition : PAL50VSyncEndPosition;
@@ -182,11 +209,28 @@ void VideoOutput::run_for(const Cycles cycles) {
 			int columns = cycles_run_for;
 			int pixel_base_address = 0xa000 + (counter_ >> 6) * 40;
 			int character_base_address = 0xbb80 + (counter_ >> 9) * 40;
-			const uint8_t blink_mask = (blink_text_ && (frame_counter_&32)) ? 0x00 : 0xff;
 
 			while(columns--) {
 				uint8_t pixels, control_byte;
 
+				// Attributes are always processed, as they affect modal state, but if the remainder of this
+				// line is unchanged then pixels needn't be generated.
+				if(!line_cache_.needs_generation()) {
+					if(is_graphics_mode_ && counter_ < 200*64) {
+						control_byte = ram_[pixel_base_address + h_counter];
+					} else {
+						control_byte = ram_[character_base_address + h_counter];
+					}
+					if(!(control_byte & 0x60)) {
+						apply_serial_attribute(control_byte);
+					}
+
+					if(rgb_pixel_target_) rgb_pixel_target_ += 6;
+					if(composite_pixel_target_) composite_pixel_target_ += 6;
+					h_counter++;
+					continue;
+				}
+
 				if(is_graphics_mode_ && counter_ < 200*64) {
 					control_byte = pixels = ram_[pixel_base_address + h_counter];
 				} else {
@@ -197,7 +241,7 @@ void VideoOutput::run_for(const Cycles cycles) {
 				}
 
 				const uint8_t inverse_mask = (control_byte & 0x80) ? 0x7 : 0x0;
-				pixels &= blink_mask;
+				if(blink_text_ && (frame_counter_&32)) pixels = 0;
 
 				if(control_byte & 0x60) {
 					if(data_type_ == Outputs::Display::InputDataType::Red1Green1Blue1 && rgb_pixel_target_) {
@@ -224,41 +268,7 @@ void VideoOutput::run_for(const Cycles cycles) {
 						composite_pixel_target_[5] = colours[(pixels >> 0)&1];
 					}
 				} else {
-					switch(control_byte & 0x1f) {
-						case 0x00:		ink_ = 0x0;	break;
-						case 0x01:		ink_ = 0x4;	break;
-						case 0x02:		ink_ = 0x2;	break;
-						case 0x03:		ink_ = 0x6;	break;
-						case 0x04:		ink_ = 0x1;	break;
-						case 0x05:		ink_ = 0x5;	break;
-						case 0x06:		ink_ = 0x3;	break;
-						case 0x07:		ink_ = 0x7;	break;
-
-						case 0x08:	case 0x09:	case 0x0a: case 0x0b:
-						case 0x0c:	case 0x0d:	case 0x0e: case 0x0f:
-							use_alternative_character_set_ = (control_byte&1);
-							use_double_height_characters_ = (control_byte&2);
-							blink_text_ = (control_byte&4);
-							set_character_set_base_address();
-						break;
-
-						case 0x10:		paper_ = 0x0;	break;
-						case 0x11:		paper_ = 0x4;	break;
-						case 0x12:		paper_ = 0x2;	break;
-						case 0x13:		paper_ = 0x6;	break;
-						case 0x14:		paper_ = 0x1;	break;
-						case 0x15:		paper_ = 0x5;	break;
-						case 0x16:		paper_ = 0x3;	break;
-						case 0x17:		paper_ = 0x7;	break;
-
-						case 0x18: case 0x19: case 0x1a: case 0x1b:
-						case 0x1c: case 0x1d: case 0x1e: case 0x1f:
-							is_graphics_mode_ = (control_byte & 4);
-							next_frame_is_sixty_hertz_ = !(control_byte & 2);
-						break;
-
-						default: break;
-					}
+					apply_serial_attribute(control_byte);
 
 					if(data_type_ == Outputs::Display::InputDataType::Red1Green1Blue1 && rgb_pixel_target_) {
 						rgb_pixel_target_[0] = rgb_pixel_target_[1] =
@@ -276,7 +286,11 @@ void VideoOutput::run_for(const Cycles cycles) {
 			}
 
 			if(h_counter == 40) {
-				crt_.output_data(40 * 6);
+				if(data_type_ == Outputs::Display::InputDataType::Red1Green1Blue1) {
+					line_cache_.output<uint8_t>(crt_, 40 * 6);
+				} else {
+					line_cache_.output<uint32_t>(crt_, 40 * 6);
+				}
 				rgb_pixel_target_ = nullptr;
 				composite_pixel_target_ = nullptr;
 			}
@@ -305,6 +319,44 @@ void VideoOutput::run_for(const Cycles cycles) {
 	}
 }
 
+void VideoOutput::apply_serial_attribute(const uint8_t control_byte) {
+	switch(control_byte & 0x1f) {
+		case 0x00:		ink_ = 0x0;	break;
+		case 0x01:		ink_ = 0x4;	break;
+		case 0x02:		ink_ = 0x2;	break;
+		case 0x03:		ink_ = 0x6;	break;
+		case 0x04:		ink_ = 0x1;	break;
+		case 0x05:		ink_ = 0x5;	break;
+		case 0x06:		ink_ = 0x3;	break;
+		case 0x07:		ink_ = 0x7;	break;
+
+		case 0x08:	case 0x09:	case 0x0a: case 0x0b:
+		case 0x0c:	case 0x0d:	case 0x0e: case 0x0f:
+			use_alternative_character_set_ = (control_byte&1);
+			use_double_height_characters_ = (control_byte&2);
+			blink_text_ = (control_byte&4);
+			set_character_set_base_address();
+		break;
+
+		case 0x10:		paper_ = 0x0;	break;
+		case 0x11:		paper_ = 0x4;	break;
+		case 0x12:		paper_ = 0x2;	break;
+		case 0x13:		paper_ = 0x6;	break;
+		case 0x14:		paper_ = 0x1;	break;
+		case 0x15:		paper_ = 0x5;	break;
+		case 0x16:		paper_ = 0x3;	break;
+		case 0x17:		paper_ = 0x7;	break;
+
+		case 0x18: case 0x19: case 0x1a: case 0x1b:
+		case 0x1c: case 0x1d: case 0x1e: case 0x1f:
+			is_graphics_mode_ = (control_byte & 4);
+			next_frame_is_sixty_hertz_ = !(control_byte & 2);
+		break;
+
+		default: break;
+	}
+}
+
 void VideoOutput::set_character_set_base_address() {
 	if(is_graphics_mode_) character_set_base_address_ = use_alternative_character_set_ ? 0x9c00 : 0x9800;
 	else character_set_base_address_ = use_alternative_character_set_ ? 0xb800 : 0xb400;
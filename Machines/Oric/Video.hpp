@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Outputs/CRT/CRT.hpp"
+#include "Outputs/CRT/LineCache.hpp"
 #include "Outputs/CRT/MismatchWarner.hpp"
 #include "ClockReceiver/ClockReceiver.hpp"
 #include "Machines/Utility/ROMCatalogue.hpp"
@@ -36,6 +37,9 @@ public:
 
 	void register_crt_frequency_mismatch();
 
+	/// Notes that @c address has been written to, so that any affected lines will be regenerated.
+	void did_write(uint16_t address);
+
 private:
 	uint8_t *ram_;
 	Outputs::CRT::CRT crt_;
@@ -54,12 +58,14 @@ private:
 	uint32_t *composite_pixel_target_ = nullptr;
 	uint32_t colour_forms_[8];
 	Outputs::Display::InputDataType data_type_;
+	Outputs::CRT::LineCache<uint32_t, 240, 224> line_cache_;
 
 	// Registers.
 	uint8_t ink_, paper_;
 
 	int character_set_base_address_ = 0xb400;
 	inline void set_character_set_base_address();
+	void apply_serial_attribute(uint8_t);
 
 	bool is_graphics_mode_ = false;
 	bool next_frame_is_sixty_hertz_ = false;
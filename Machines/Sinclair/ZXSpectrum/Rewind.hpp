@@ -0,0 +1,177 @@
+//
+//  Rewind.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "State.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace Sinclair::ZXSpectrum {
+
+/*!
+	Retains a bounded history of machine states, oldest first, from which any can be restored.
+
+	To keep memory bounded, RAM is stored as a run-length encoding of its exclusive OR with
+	the RAM of the preceding capture. Every @c KeyInterval captures, and always for the oldest
+	capture, a full copy is retained instead, so that no restoration needs to apply more than
+	@c KeyInterval deltas.
+*/
+class Rewind {
+public:
+	static constexpr size_t KeyInterval = 100;
+
+	Rewind(const size_t capacity) : capacity_(capacity) {
+		assert(capacity);
+	}
+
+	/// Adds @c state as the most recent capture, discarding the oldest if capacity is exceeded.
+	void push(State &&state) {
+		Capture capture;
+		capture.is_key = captures_.empty() || !(++captures_since_key_ % KeyInterval);
+		if(capture.is_key) {
+			captures_since_key_ = 0;
+			capture.ram = state.ram;
+		} else {
+			encode(last_ram_, state.ram, capture.ram);
+		}
+		last_ram_ = std::move(state.ram);
+		capture.state = std::move(state);
+		captures_.push_back(std::move(capture));
+
+		if(captures_.size() > capacity_) {
+			// Keep the oldest capture complete: if what will now be the oldest is only a delta,
+			// apply it to the complete RAM that is about to be discarded.
+			auto &successor = captures_[1];
+			if(!successor.is_key) {
+				apply(successor.ram, captures_.front().ram);
+				successor.ram = std::move(captures_.front().ram);
+				successor.is_key = true;
+			}
+			captures_.pop_front();
+		}
+	}
+
+	/// @returns The number of captures currently held.
+	size_t size() const {
+		return captures_.size();
+	}
+
+	/// @returns The number of bytes currently occupied by RAM images and deltas.
+	size_t ram_bytes() const {
+		size_t total = last_ram_.capacity();
+		for(const auto &capture: captures_) {
+			total += capture.ram.capacity();
+		}
+		return total;
+	}
+
+	/*!
+		Rebuilds the state captured @c captures_ago captures before the most recent, which must
+		be less than @c size(). All more recent captures are discarded, so that the rebuilt state
+		becomes the most recent.
+	*/
+	State restore(const size_t captures_ago) {
+		assert(captures_ago < captures_.size());
+		const size_t target = captures_.size() - 1 - captures_ago;
+
+		// Find the nearest complete RAM image and apply deltas from there.
+		size_t key = target;
+		while(!captures_[key].is_key) --key;
+		std::vector<uint8_t> ram = captures_[key].ram;
+		for(size_t c = key + 1; c <= target; c++) {
+			apply(captures_[c].ram, ram);
+		}
+
+		captures_.erase(captures_.begin() + ptrdiff_t(target) + 1, captures_.end());
+		captures_since_key_ = target - key;
+		last_ram_ = ram;
+
+		State state = captures_.back().state;
+		state.ram = std::move(ram);
+		return state;
+	}
+
+private:
+	struct Capture {
+		/// The captured state, with its RAM moved to @c ram in whichever form is applicable.
+		State state;
+		/// Either a complete RAM image or, if not @c is_key, a delta as per @c encode.
+		std::vector<uint8_t> ram;
+		bool is_key = false;
+	};
+	std::deque<Capture> captures_;
+	const size_t capacity_;
+	size_t captures_since_key_ = 0;
+
+	/// The complete RAM of the most recent capture.
+	std::vector<uint8_t> last_ram_;
+
+	// Deltas are a sequence of: [run length of unchanged bytes], [count of changed bytes],
+	// [that many bytes to exclusive OR], with each length encoded seven bits at a time,
+	// low bits first, and bit 7 set on all but the final byte.
+	static void put_length(std::vector<uint8_t> &target, size_t length) {
+		while(length >= 0x80) {
+			target.push_back(uint8_t(length | 0x80));
+			length >>= 7;
+		}
+		target.push_back(uint8_t(length));
+	}
+
+	static size_t get_length(const uint8_t *&source) {
+		size_t length = 0;
+		int shift = 0;
+		while(true) {
+			const uint8_t next = *source++;
+			length |= size_t(next & 0x7f) << shift;
+			if(!(next & 0x80)) return length;
+			shift += 7;
+		}
+	}
+
+	static void encode(const std::vector<uint8_t> &previous, const std::vector<uint8_t> &current, std::vector<uint8_t> &delta) {
+		assert(previous.size() == current.size());
+		const size_t size = current.size();
+
+		size_t c = 0;
+		while(c < size) {
+			const size_t unchanged_start = c;
+			while(c < size && previous[c] == current[c]) ++c;
+			if(c == size) break;
+
+			const size_t changed_start = c;
+			while(c < size && previous[c] != current[c]) ++c;
+
+			put_length(delta, changed_start - unchanged_start);
+			put_length(delta, c - changed_start);
+			for(size_t d = changed_start; d < c; d++) {
+				delta.push_back(previous[d] ^ current[d]);
+			}
+		}
+		delta.shrink_to_fit();
+	}
+
+	static void apply(const std::vector<uint8_t> &delta, std::vector<uint8_t> &ram) {
+		const uint8_t *source = delta.data();
+		const uint8_t *const end = source + delta.size();
+		uint8_t *target = ram.data();
+		while(source != end) {
+			target += get_length(source);
+			size_t changed = get_length(source);
+			while(changed--) {
+				*target++ ^= *source++;
+			}
+		}
+	}
+};
+
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Outputs/CRT/CRT.hpp"
+#include "Outputs/CRT/LineCache.hpp"
 #include "ClockReceiver/ClockReceiver.hpp"
 
 #include "Reflection/Struct.hpp"
@@ -136,7 +137,11 @@ public:
 
 				if(!line) {
 					flash_counter_ = (flash_counter_ + 1) & 31;
-					flash_mask_ = uint8_t(flash_counter_ >> 4);
+					const auto flash_mask = uint8_t(flash_counter_ >> 4);
+					if(flash_mask != flash_mask_) {
+						flash_mask_ = flash_mask;
+						line_cache_.invalidate_all();
+					}
 				}
 			}
 
@@ -157,25 +162,24 @@ public:
 						const int pixel_duration = std::min(256, end_offset) - offset;
 
 						if(!offset) {
-							pixel_target_ = crt_.begin_data(256);
+							pixel_target_ = line_cache_.begin_line(size_t(line));
 							attribute_address_ = ((line >> 3) << 5) + 6144;
 							pixel_address_ = ((line & 0x07) << 8) | ((line & 0x38) << 2) | ((line & 0xc0) << 5);
 						}
 
-						if(pixel_target_) {
-							const int start_column = offset >> 4;
-							const int end_column = (offset + pixel_duration) >> 4;
-							for(int column = start_column; column < end_column; column++) {
-								last_fetches_[0] = memory_[pixel_address_];
-								last_fetches_[1] = memory_[attribute_address_];
-								last_fetches_[2] = memory_[pixel_address_+1];
-								last_fetches_[3] = memory_[attribute_address_+1];
-								set_last_contended_area_access(last_fetches_[3]);
+						const int start_column = offset >> 4;
+						const int end_column = (offset + pixel_duration) >> 4;
+						for(int column = start_column; column < end_column; column++) {
+							last_fetches_[0] = memory_[pixel_address_];
+							last_fetches_[1] = memory_[attribute_address_];
+							last_fetches_[2] = memory_[pixel_address_+1];
+							last_fetches_[3] = memory_[attribute_address_+1];
+							set_last_contended_area_access(last_fetches_[3]);
 
-								pixel_address_ += 2;
-								attribute_address_ += 2;
+							pixel_address_ += 2;
+							attribute_address_ += 2;
 
-								constexpr uint8_t masks[] = {0, 0xff};
+							constexpr uint8_t masks[] = {0, 0xff};
 
 #define Output(n)	\
 	{				\
@@ -198,16 +202,19 @@ public:
 		pixel_target_ += 8;									\
 	}
 
+							if(line_cache_.needs_generation()) {
 								Output(0);
 								Output(2);
+							} else {
+								pixel_target_ += 16;
+							}
 
 #undef Output
-							}
 						}
 
 						offset += pixel_duration;
 						if(offset == 256) {
-							crt_.output_data(256);
+							line_cache_.output(crt_, 256);
 							pixel_target_ = nullptr;
 						}
 					}
@@ -268,12 +275,14 @@ private:
 		}
 	}
 
+public:
 	static constexpr HalfCycles frame_duration() {
 		const auto timings = get_timings();
 		return HalfCycles(timings.half_cycles_per_line * timings.lines_per_frame);
 	}
 
-	HalfCycles time_since_interrupt() {
+private:
+	HalfCycles time_since_interrupt() const {
 		const auto timings = get_timings();
 		if(time_into_frame_ >= timings.interrupt_time) {
 			return HalfCycles(time_into_frame_ - timings.interrupt_time);
@@ -292,13 +301,13 @@ private:
 		if(target == now) return;
 
 		// Is the time within this frame?
-		if(time > now) {
-			run_for(target - time);
+		if(target > now) {
+			run_for(target - now);
 			return;
 		}
 
 		// Then it's necessary to finish this frame and run into the next.
-		run_for(frame_duration() - now + time);
+		run_for(frame_duration() - now + target);
 	}
 
 public:
@@ -317,6 +326,9 @@ public:
 
 	void set_video_source(const uint8_t *const source) {
 		const bool is_first_set = !memory_;
+		if(source != memory_) {
+			line_cache_.invalidate_all();
+		}
 		memory_ = source;
 		if(is_first_set) {
 			crt_.set_fixed_framing([&] {
@@ -413,6 +425,26 @@ public:
 		}
 	}
 
+	/*!
+		Notes that @c address, an offset into the current video source, has been written to, so that
+		any affected lines will be regenerated.
+	*/
+	void did_write(const uint16_t address) {
+		if(address < 6144) {
+			line_cache_.invalidate(((address >> 8) & 0x07) | ((address >> 2) & 0x38) | ((address >> 5) & 0xc0));
+		} else if(address < 6912) {
+			const size_t row = size_t(address - 6144) >> 5;
+			line_cache_.invalidate(row * 8, row * 8 + 8);
+		}
+	}
+
+	/*!
+		Notes that the entire video source may have been modified.
+	*/
+	void did_write_all() {
+		line_cache_.invalidate_all();
+	}
+
 	/*!
 		Sets the current border colour.
 	*/
@@ -449,6 +481,7 @@ private:
 	uint8_t border_byte_ = 0;
 
 	uint8_t *pixel_target_ = nullptr;
+	Outputs::CRT::LineCache<uint8_t, 256, 192> line_cache_;
 	int attribute_address_ = 0;
 	int pixel_address_ = 0;
 
@@ -489,11 +522,14 @@ struct State: public Reflection::StructImpl<State> {
 	}
 
 	template <typename Video> void apply(Video &target) {
+		// Set time first, as getting there may involve running the video, which
+		// would otherwise disturb the other fields.
+		target.set_time_since_interrupt(HalfCycles(half_cycles_since_interrupt));
 		target.set_border_colour(border_colour);
 		target.flash_mask_ = flash ? 0xff : 0x00;
+		target.line_cache_.invalidate_all();
 		target.flash_counter_ = flash_counter;
 		target.is_alternate_line_ = is_alternate_line;
-		target.set_time_since_interrupt(HalfCycles(half_cycles_since_interrupt));
 	}
 
 private:
@@ -8,6 +8,7 @@
 
 #include "ZXSpectrum.hpp"
 
+#include "Rewind.hpp"
 #include "State.hpp"
 #include "Video.hpp"
 #include "Machines/Sinclair/Keyboard/Keyboard.hpp"
@@ -36,6 +37,7 @@
 #include "Analyser/Static/ZXSpectrum/Target.hpp"
 
 #include "Machines/Utility/MemoryFuzzer.hpp"
+#include "Machines/Utility/TapeEdgeAccelerator.hpp"
 #include "Machines/Utility/Typer.hpp"
 
 #include "ClockReceiver/JustInTime.hpp"
@@ -97,13 +99,13 @@ public:
 
 	/// @returns The value that a Kempston joystick interface would report if this joystick
 	/// were plugged into it.
-	uint8_t get_kempston() {
+	uint8_t get_kempston() const {
 		return kempston_.load(std::memory_order_relaxed);
 	}
 
 	/// @returns The value that a Sinclair interface would report if this joystick
 	/// were plugged into it via @c port (which should be either 0 or 1, for ports 1 or 2).
-	uint8_t get_sinclair(const int port) {
+	uint8_t get_sinclair(const int port) const {
 		return uint8_t(sinclair_.load(std::memory_order_relaxed) >> (port * 8));
 	}
 
@@ -172,8 +174,9 @@ public:
 			throw ROMMachine::Error::MissingROMs;
 		}
 
-		const auto &rom = roms.find(rom_name)->second;
-		std::copy_n(rom.begin(), std::min(rom_.size(), rom.size()), rom_.begin());
+		auto &rom = roms.find(rom_name)->second;
+		rom.resize(64*1024);
+		rom_ = ROM::shared_image(rom_name, std::move(rom));
 
 		// Register for sleeping notifications.
 		tape_player_.set_clocking_hint_observer(this);
@@ -199,25 +202,7 @@ public:
 
 		// Install state if supplied.
 		if(target.state) {
-			const auto state = static_cast<State *>(target.state.get());
-			state->z80.apply(z80_);
-			state->video.apply(*video_.get());
-			state->ay.apply(ay_);
-
-			// If this is a 48k or 16k machine, remap source data from its original
-			// linear form to whatever the banks end up being; otherwise copy as is.
-			if(model <= Model::FortyEightK) {
-				const size_t num_banks = std::min(size_t(48*1024), state->ram.size()) >> 14;
-				for(size_t c = 0; c < num_banks; c++) {
-					std::copy_n(&state->ram[c * 0x4000], 0x4000, &banks_[c + 1].write[(c+1) * 0x4000]);
-				}
-			} else {
-				std::copy_n(state->ram.begin(), std::min(ram_.size(), state->ram.size()), ram_.data());
-
-				port1ffd_ = state->last_1ffd;
-				port7ffd_ = state->last_7ffd;
-				update_memory_map();
-			}
+			set_state(*static_cast<State *>(target.state.get()));
 		}
 	}
 
@@ -259,8 +244,23 @@ public:
 	// MARK: - TimedMachine.
 
 	void run_for(const Cycles cycles) override {
+		const bool run_ahead = should_run_ahead();
+		if(run_ahead_frames_) {
+			// Video from the real timeline is presented only if not running ahead.
+			video_.flush();
+			scan_target_.set_is_enabled(!run_ahead);
+		}
+
 		z80_.run_for(cycles);
 
+		if(rewind_) {
+			time_since_rewind_capture_ += HalfCycles(cycles);
+			if(time_since_rewind_capture_ >= rewind_interval_) {
+				time_since_rewind_capture_ %= rewind_interval_;
+				rewind_->push(get_state());
+			}
+		}
+
 		// Use this very broad timing base for the automatic enter depression.
 		// It's not worth polluting the main loop.
 		if(duration_to_press_enter_ > Cycles(0)) {
@@ -271,6 +271,19 @@ public:
 				duration_to_press_enter_ -= cycles;
 			}
 		}
+
+		// Run ahead once per frame of real time, or sooner if input has changed, as only
+		// the most recent speculative frame is ever presented.
+		if(run_ahead) {
+			time_since_run_ahead_ += HalfCycles(cycles);
+			const auto input = current_input();
+			if(time_since_run_ahead_ >= VideoType::frame_duration() || input_did_change_ || input != run_ahead_input_) {
+				time_since_run_ahead_ = HalfCycles(0);
+				input_did_change_ = false;
+				run_ahead_input_ = input;
+				perform_run_ahead();
+			}
+		}
 	}
 
 	void flush_output(int outputs) override {
@@ -302,7 +315,8 @@ public:
 	// MARK: - ScanProducer.
 
 	void set_scan_target(Outputs::Display::ScanTarget *scan_target) override {
-		video_.get()->set_scan_target(scan_target);
+		scan_target_.set_target(scan_target);
+		video_.get()->set_scan_target(&scan_target_);
 	}
 
 	Outputs::Display::ScanStatus get_scaled_scan_status() const override {
@@ -323,6 +337,7 @@ public:
 		using PartialMachineCycle = CPU::Z80::PartialMachineCycle;
 
 		const uint16_t address = cycle.address ? *cycle.address : 0x0000;
+		tape_edge_accelerator_.did_perform(cycle);
 
 		// Apply contention if necessary.
 		if constexpr (model >= Model::Plus2a) {
@@ -425,7 +440,7 @@ public:
 				// Fast loading: ROM version.
 				//
 				// The below patches over part of the 'LD-BYTES' routine from the 48kb ROM.
-				if(use_fast_tape_hack_ && address == 0x056b && banks_[0].read == &rom_[classic_rom_offset()]) {
+				if(use_fast_tape_hack_ && !is_running_ahead_ && address == 0x056b && banks_[0].read == &(*rom_)[classic_rom_offset()]) {
 					// Stop pressing enter, if neccessry.
 					if(duration_to_press_enter_ > Cycles(0)) {
 						duration_to_press_enter_ = Cycles(0);
@@ -462,6 +477,7 @@ public:
 				// Flush video if this access modifies screen contents.
 				if(banks_[address >> 14].is_video && (address & 0x3fff) < 6912) {
 					video_.flush();
+					video_.get()->did_write(address & 0x3fff);
 				}
 
 				banks_[address >> 14].write[address] = *cycle.value;
@@ -563,6 +579,9 @@ public:
 
 					*cycle.value &= keyboard_.read(address);
 					*cycle.value &= tape_player_.input() ? 0xbf : 0xff;
+					if(use_fast_tape_hack_ && !is_running_ahead_) {
+						tape_edge_accelerator_.did_read_input(z80_, tape_player_);
+					}
 
 					// Add Joystick input on top.
 					if(!(address&0x1000)) *cycle.value &= static_cast<Joystick *>(joysticks_[0].get())->get_sinclair(0);
@@ -641,7 +660,10 @@ private:
 			z80_.set_interrupt_line(video_.get()->get_interrupt_line(), video_.last_sequence_point_overrun());
 		}
 
-		if(!tape_player_is_sleeping_) tape_player_.run_for(Cycles(duration.get()));
+		if(!tape_player_is_sleeping_ && !is_running_ahead_) {
+			tape_player_.run_for(Cycles(duration.get()));
+			tape_edge_accelerator_.run_for(Cycles(duration.get()));
+		}
 
 		// Update automatic tape motor control, if enabled; if it's been
 		// 0.5 seconds since software last possibly polled the tape, stop it.
@@ -688,10 +710,12 @@ public:
 	void set_key_state(uint16_t key, bool is_pressed) override {
 		// TODO: Handle KeyExtendedMode.
 		keyboard_.set_key_state(key, is_pressed);
+		input_did_change_ = true;
 	}
 
 	void clear_all_keys() override {
 		keyboard_.clear_all_keys();
+		input_did_change_ = true;
 
 		// Caveat: if holding enter synthetically, continue to do so.
 		if(duration_to_press_enter_ > Cycles(0)) {
@@ -747,6 +771,42 @@ public:
 		return tape_player_.motor_control();
 	}
 
+	// MARK: - Rewind.
+
+	void set_rewind_history(const int frames_per_capture, const size_t capacity) final {
+		if(!capacity) {
+			rewind_.reset();
+			return;
+		}
+		rewind_ = std::make_unique<Rewind>(capacity);
+		rewind_interval_ = VideoType::frame_duration() * std::max(frames_per_capture, 1);
+		time_since_rewind_capture_ = HalfCycles(0);
+	}
+
+	size_t get_rewind_depth() const final {
+		return rewind_ ? rewind_->size() : 0;
+	}
+
+	bool rewind(const size_t captures_ago) final {
+		if(captures_ago >= get_rewind_depth()) {
+			return false;
+		}
+		auto state = rewind_->restore(captures_ago);
+		set_state(state);
+		time_since_rewind_capture_ = HalfCycles(0);
+		return true;
+	}
+
+	// MARK: - Run-ahead.
+
+	void set_run_ahead_frames(const int frames) final {
+		run_ahead_frames_ = std::max(frames, 0);
+		if(!run_ahead_frames_) {
+			video_.flush();
+			scan_target_.set_is_enabled(true);
+		}
+	}
+
 	// MARK: - Configuration options.
 
 	std::unique_ptr<Reflection::Struct> get_options() const override {
@@ -781,7 +841,7 @@ private:
 	CPU::Z80::Processor<ConcreteMachine, false, false> z80_;
 
 	// MARK: - Memory.
-	std::array<uint8_t, 64*1024> rom_;
+	ROM::Image rom_;
 	std::array<uint8_t, 128*1024> ram_;
 
 	std::array<uint8_t, 16*1024> scratch_;
@@ -859,11 +919,15 @@ private:
 		}
 		banks_[bank].page = source;
 
-		uint8_t *const read = (source < 0x80) ? &ram_[source * 16384] : &rom_[(source & 0x7f) * 16384];
 		const auto offset = bank*16384;
-
-		banks_[bank].read = read - offset;
-		banks_[bank].write = ((source < 0x80) ? read : scratch_.data()) - offset;
+		if(source < 0x80) {
+			uint8_t *const ram = &ram_[source * 16384];
+			banks_[bank].read = ram - offset;
+			banks_[bank].write = ram - offset;
+		} else {
+			banks_[bank].read = &(*rom_)[(source & 0x7f) * 16384] - offset;
+			banks_[bank].write = scratch_.data() - offset;
+		}
 	}
 
 	void set_video_address() {
@@ -888,6 +952,8 @@ private:
 
 	HalfCycles time_since_audio_update_;
 	void update_audio() {
+		// Audio is neither generated nor consumed while running ahead.
+		if(is_running_ahead_) return;
 		const auto cycles = time_since_audio_update_.divide<Cycles>(2);
 		speaker_.run_for(
 			audio_queue_,
@@ -912,12 +978,124 @@ private:
 
 	// MARK: - Tape.
 	Storage::Tape::BinaryTapePlayer tape_player_;
+	Utility::TapeEdgeAccelerator tape_edge_accelerator_;
 	bool tape_player_is_sleeping_ = false;
 
 	bool use_automatic_tape_motor_control_ = true;
 	HalfCycles cycles_since_tape_input_read_;
 	int recent_tape_hits_ = 0;
 
+	// MARK: - State.
+
+	State get_state() {
+		State state;
+		state.z80 = CPU::Z80::State(z80_);
+		video_.flush();
+		state.video = Video::State(*video_.get());
+		state.ay = GI::AY38910::State(ay_);
+
+		// As per set_state: 16kb and 48kb machines store RAM linearly; others store all banks in order.
+		if constexpr (model <= Model::FortyEightK) {
+			state.ram.resize(48*1024);
+			for(size_t c = 0; c < 3; c++) {
+				std::copy_n(&banks_[c + 1].write[(c+1) * 0x4000], 0x4000, &state.ram[c * 0x4000]);
+			}
+		} else {
+			state.ram.assign(ram_.begin(), ram_.end());
+			state.last_1ffd = port1ffd_;
+			state.last_7ffd = port7ffd_;
+		}
+		return state;
+	}
+
+	void set_state(State &state) {
+		state.z80.apply(z80_);
+		video_.flush();
+		state.video.apply(*video_.get());
+		video_.update_sequence_point();
+
+		// Rewriting the envelope shape would restart the envelope, so write only what has changed.
+		state.ay.apply_changes(ay_);
+
+		// If this is a 48k or 16k machine, remap source data from its original
+		// linear form to whatever the banks end up being; otherwise copy as is.
+		if constexpr (model <= Model::FortyEightK) {
+			const size_t num_banks = std::min(size_t(48*1024), state.ram.size()) >> 14;
+			for(size_t c = 0; c < num_banks; c++) {
+				std::copy_n(&state.ram[c * 0x4000], 0x4000, &banks_[c + 1].write[(c+1) * 0x4000]);
+			}
+		} else {
+			std::copy_n(state.ram.begin(), std::min(ram_.size(), state.ram.size()), ram_.data());
+
+			disable_paging_ = false;
+			port1ffd_ = state.last_1ffd;
+			port7ffd_ = state.last_7ffd;
+			update_memory_map();
+			set_video_address();
+		}
+	}
+
+	bool should_run_ahead() const {
+		if constexpr (model == Model::Plus3) {
+			// The FDC isn't included in State.
+			return false;
+		}
+		return run_ahead_frames_ && !tape_player_.motor_control() && !typer_;
+	}
+
+	void perform_run_ahead() {
+		// Capture everything that running ahead could affect.
+		auto state = get_state();
+		const auto time_since_audio_update = time_since_audio_update_;
+		const bool audio_toggle = audio_toggle_.get_output();
+		const bool tape_motor = tape_player_.motor_control();
+		const auto cycles_since_tape_input_read = cycles_since_tape_input_read_;
+		const int recent_tape_hits = recent_tape_hits_;
+
+		// Run ahead, presenting only the final frame. Audio queue traffic is discarded, both
+		// from the speculative frames and from the rollback, so the audio thread sees only the
+		// real timeline.
+		is_running_ahead_ = true;
+		audio_queue_.set_is_enabled(false);
+		const auto frame_duration = VideoType::frame_duration();
+		z80_.run_for(frame_duration * (run_ahead_frames_ - 1));
+		video_.flush();
+		scan_target_.set_is_enabled(true);
+		z80_.run_for(frame_duration);
+		video_.flush();
+		scan_target_.set_is_enabled(false);
+		is_running_ahead_ = false;
+
+		// Roll back.
+		set_state(state);
+		time_since_audio_update_ = time_since_audio_update;
+		audio_toggle_.set_output(audio_toggle);
+		if(tape_player_.motor_control() != tape_motor) {
+			tape_player_.set_motor_control(tape_motor);
+		}
+		cycles_since_tape_input_read_ = cycles_since_tape_input_read;
+		recent_tape_hits_ = recent_tape_hits;
+		audio_queue_.set_is_enabled(true);
+	}
+
+	/// @returns A summary of joystick state, to detect changes between run-aheads.
+	uint32_t current_input() const {
+		const auto &first = *static_cast<Joystick *>(joysticks_[0].get());
+		const auto &second = *static_cast<Joystick *>(joysticks_[1].get());
+		return uint32_t(first.get_kempston() | (first.get_sinclair(0) << 8) | (second.get_sinclair(1) << 16));
+	}
+
+	Outputs::Display::GatedScanTarget scan_target_;
+	int run_ahead_frames_ = 0;
+	bool is_running_ahead_ = false;
+	HalfCycles time_since_run_ahead_;
+	bool input_did_change_ = false;
+	uint32_t run_ahead_input_ = 0;
+
+	std::unique_ptr<Rewind> rewind_;
+	HalfCycles rewind_interval_;
+	HalfCycles time_since_rewind_capture_;
+
 	bool allow_fast_tape_hack_ = false;
 	bool use_fast_tape_hack_ = false;
 	void set_use_fast_tape() {
@@ -972,6 +1150,7 @@ private:
 			parity ^= *next;
 			++target;
 		}
+		video_.get()->did_write_all();
 
 		auto stored_parity = parser.get_byte(*tape_player_.serialiser());
 		if(!stored_parity) {
@@ -24,6 +24,28 @@ struct Machine {
 	virtual void set_tape_is_playing(bool is_playing) = 0;
 	virtual bool get_tape_is_playing() = 0;
 
+	/// Enables rewind, capturing state every @c frames_per_capture frames and retaining
+	/// up to @c capacity captures. A @c capacity of zero disables rewind.
+	virtual void set_rewind_history(int frames_per_capture, size_t capacity) = 0;
+
+	/// @returns The number of captures currently available to @c rewind.
+	virtual size_t get_rewind_depth() const = 0;
+
+	/// Restores the state captured @c captures_ago captures before the most recent one,
+	/// which becomes the most recent. Tape, disk and input state are not rewound.
+	///
+	/// @returns @c true if that capture existed; @c false otherwise.
+	virtual bool rewind(size_t captures_ago) = 0;
+
+	/// Sets the number of frames by which to run ahead. While running ahead, the machine
+	/// runs that many frames beyond real time after each call to run_for, presents only the
+	/// video of the final one and then rolls back, so that the effect of new input is
+	/// visible that many frames sooner. Zero disables run-ahead.
+	///
+	/// Run-ahead is suspended while the tape is playing or text is being typed, and
+	/// isn't available on the +3.
+	virtual void set_run_ahead_frames(int frames) = 0;
+
 	class Options:
 		public Reflection::StructImpl<Options>,
 		public Configurable::Options::Display<Options>,
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ClockReceiver/ClockReceiver.hpp"
+#include "ClockReceiver/Profiler.hpp"
 #include "ClockReceiver/TimeTypes.hpp"
 
 #include "AudioProducer.hpp"
@@ -28,7 +29,11 @@ public:
 	virtual void run_for(const Time::Seconds duration) {
 		const double cycles = (duration * clock_rate_ * speed_multiplier_) + clock_conversion_error_;
 		clock_conversion_error_ = std::fmod(cycles, 1.0);
-		run_for(Cycles(int(cycles)));
+		{
+			const Profiler::Scope scope(Profiler::Component::CPU, int64_t(cycles));
+			run_for(Cycles(int(cycles)));
+		}
+		Profiler::did_run_for(duration * speed_multiplier_);
 	}
 
 	/*!
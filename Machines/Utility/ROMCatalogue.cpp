@@ -13,6 +13,7 @@
 #include <cstdlib>
 #include <iomanip>
 #include <locale>
+#include <mutex>
 #include <optional>
 #include <sstream>
 
@@ -1744,3 +1745,27 @@ Description::Description(const Name name) {
 		*this = *rom;
 	}
 }
+
+Image ROM::shared_image(const Name name, std::vector<uint8_t> &&contents) {
+	// Images are held only weakly here; each lives only for as long as a machine is using it.
+	static std::mutex mutex;
+	static std::multimap<Name, std::weak_ptr<const std::vector<uint8_t>>> images;
+	std::lock_guard lock(mutex);
+
+	const auto [begin, end] = images.equal_range(name);
+	for(auto candidate = begin; candidate != end;) {
+		const auto image = candidate->second.lock();
+		if(!image) {
+			candidate = images.erase(candidate);
+			continue;
+		}
+		if(*image == contents) {
+			return image;
+		}
+		++candidate;
+	}
+
+	const auto image = std::make_shared<const std::vector<uint8_t>>(std::move(contents));
+	images.emplace(name, image);
+	return image;
+}
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -233,6 +234,16 @@ enum Name {
 
 using Map = std::map<ROM::Name, std::vector<uint8_t>>;
 
+/// An immutable ROM image, which may be shared by any number of machines.
+using Image = std::shared_ptr<const std::vector<uint8_t>>;
+
+/*!
+	@returns An image of @c contents. If an image with the same name and contents is already
+	held by any other machine then that same image is returned, so that any number of machines
+	can share a single copy of each ROM.
+*/
+Image shared_image(Name, std::vector<uint8_t> &&contents);
+
 struct Description {
 	/// The ROM's enum name.
 	Name name = Name::None;
@@ -0,0 +1,237 @@
+//
+//  TapeEdgeAccelerator.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "ClockReceiver/ClockReceiver.hpp"
+#include "Processors/Z80/Z80.hpp"
+#include "Storage/Tape/Tape.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace Utility {
+
+/*!
+	Recognises the tight loops in which Z80 software, such as a custom turbo loader, waits for the next
+	edge on a tape input, and fast forwards the tape to just before that edge rather than having the loop
+	spin until it arrives.
+
+	A loop is a sequence of reads of the tape input that occur at the same program counter, at a constant
+	period, with interrupts disabled and with no memory writes or output in between. Other than the refresh
+	register, the only register that may change is at most one 8-bit counter, which must move by one per
+	iteration; the flags may also change, but only to exactly those that an INC or DEC of that counter would
+	produce. The alternate register set and the index registers must be identical at every read, so e.g.
+	a loop that exchanges register sets between reads is not accelerated; so must A, other than upon a read
+	that observes a change in input, since A may be the destination of the read. A loop is recognised as waiting for
+	an edge once it has run for @c Confidence reads with an unchanged input and has then been seen to end
+	immediately after the read that observes a change in input; that distinguishes it from, e.g., a loop
+	that polls some other signal on the same port.
+
+	From then on, any pair of reads that repeats it — including after it has been left and re-entered,
+	as happens at every edge — causes the tape to be advanced by as many whole periods as fit before its
+	next event, and the changes that those iterations would have made to the counter, the flags and the refresh
+	register to be applied. The counter is never taken as far as zero, as that is assumed to end the loop.
+
+	Nothing else is affected, so skipped iterations take no emulated time: the loader sees pulses arrive
+	more quickly than it otherwise would, while any border or other output that it generates per edge
+	is unchanged.
+
+	Time is measured in the tape player's input clock: the owner should call @c run_for for the same
+	periods that it runs the tape for, @c did_perform for every bus cycle in that time, and @c did_read_input
+	after each read of the tape input.
+*/
+class TapeEdgeAccelerator {
+public:
+	void run_for(const Cycles cycles) {
+		time_ += cycles.get();
+	}
+
+	void did_perform(const CPU::Z80::PartialMachineCycle &cycle) {
+		using Operation = CPU::Z80::PartialMachineCycle::Operation;
+		has_side_effects_ |= cycle.operation == Operation::Write || cycle.operation == Operation::Output;
+	}
+
+	void did_read_input(CPU::Z80::ProcessorBase &z80, Storage::Tape::BinaryTapePlayer &tape) {
+		using Register = CPU::Z80::Register;
+
+		Read read;
+		read.time = time_;
+		read.pc = z80.value_of(Register::ProgramCounter);
+		read.input = tape.input();
+		for(size_t c = 0; c < Counters.size(); c++) {
+			read.counters[c] = uint8_t(z80.value_of(Counters[c]));
+		}
+		read.a = uint8_t(z80.value_of(Register::A));
+		read.flags = uint8_t(z80.value_of(Register::Flags));
+		for(size_t c = 0; c < Unchanging.size(); c++) {
+			read.unchanging[c] = z80.value_of(Unchanging[c]);
+		}
+		read.r = uint8_t(z80.value_of(Register::R));
+		read.has_side_effects = has_side_effects_;
+		has_side_effects_ = false;
+
+		const bool did_change = read.input != previous_.input;
+		const Loop loop = loop_between(previous_, read, did_change);
+		const bool is_candidate = loop.is_valid && tape.motor_control() && !z80.value_of(Register::IFF1);
+
+		if(is_ending_ && loop != loop_) {
+			recognised_ = loop_;
+		}
+		is_ending_ = is_candidate && did_change && loop == loop_ && confidence_ == Confidence;
+		confidence_ = is_candidate && !did_change && loop == loop_ ? std::min(confidence_ + 1, Confidence) : 0;
+		loop_ = loop;
+		previous_ = read;
+
+		if(!is_candidate || did_change || loop != recognised_) {
+			return;
+		}
+
+		// Skip whole iterations for as long as the tape input is certain to be unchanged, stopping
+		// short of the one in which the counter, if any, would reach zero.
+		auto iterations = (tape.get_cycles_until_next_event() - 1) / loop.period;
+		iterations = std::min(iterations, MaximumSkip / loop.period);
+		if(loop.counter != NoCounter) {
+			const uint8_t counter = read.counters[size_t(loop.counter)];
+			const int until_zero = loop.delta > 0 ? uint8_t(-counter) : counter;
+			iterations = std::min<Cycles::IntType>(iterations, until_zero - 1);
+		}
+		if(iterations <= 0) {
+			return;
+		}
+
+		tape.run_for(Cycles(iterations * loop.period));
+
+		if(loop.counter != NoCounter) {
+			auto &counter = previous_.counters[size_t(loop.counter)];
+			counter = uint8_t(counter + iterations * loop.delta);
+			z80.set_value_of(Counters[size_t(loop.counter)], counter);
+
+			if(loop.flags_follow_counter) {
+				previous_.flags = counter_flags(counter, loop.delta, read.flags);
+				z80.set_value_of(Register::Flags, previous_.flags);
+			}
+		}
+		previous_.r = uint8_t((read.r & 0x80) | ((read.r + iterations * loop.refresh_delta) & 0x7f));
+		z80.set_value_of(Register::R, previous_.r);
+	}
+
+private:
+	/// The number of consecutive matching reads required before iterations are skipped.
+	static constexpr int Confidence = 4;
+
+	/// The most time to skip in one go, in input clock cycles, to keep a loop that polls
+	/// through a long silence from leaping across it in a single step.
+	static constexpr Cycles::IntType MaximumSkip = 65536;
+
+	/// Registers that may act as a loop counter.
+	static constexpr std::array Counters = {
+		CPU::Z80::Register::B, CPU::Z80::Register::C,
+		CPU::Z80::Register::D, CPU::Z80::Register::E,
+		CPU::Z80::Register::H, CPU::Z80::Register::L,
+	};
+	static constexpr int NoCounter = -1;
+
+	/// Registers that must be identical at every read, other than A and the flags.
+	static constexpr std::array Unchanging = {
+		CPU::Z80::Register::IX, CPU::Z80::Register::IY, CPU::Z80::Register::StackPointer,
+		CPU::Z80::Register::AFDash, CPU::Z80::Register::BCDash,
+		CPU::Z80::Register::DEDash, CPU::Z80::Register::HLDash,
+		CPU::Z80::Register::I,
+	};
+
+	struct Read {
+		Cycles::IntType time = 0;
+		uint16_t pc = 0;
+		bool input = false;
+		std::array<uint8_t, Counters.size()> counters{};
+		uint8_t a = 0, flags = 0;
+		std::array<uint16_t, Unchanging.size()> unchanging{};
+		uint8_t r = 0;
+		bool has_side_effects = false;
+	};
+
+	/// Describes one iteration of a candidate loop.
+	struct Loop {
+		bool is_valid = false;
+		uint16_t pc = 0;
+		Cycles::IntType period = 0;
+		int counter = NoCounter;
+		int delta = 0;
+		bool flags_follow_counter = false;
+		int refresh_delta = 0;
+
+		bool operator ==(const Loop &) const = default;
+	};
+
+	static Loop loop_between(const Read &previous, const Read &read, const bool did_change) {
+		Loop loop;
+		loop.pc = read.pc;
+		loop.period = read.time - previous.time;
+		loop.refresh_delta = (read.r - previous.r) & 0x7f;
+		if(
+			loop.period <= 0 ||
+			read.has_side_effects ||
+			read.pc != previous.pc ||
+			(read.a != previous.a && !did_change) ||
+			read.unchanging != previous.unchanging
+		) {
+			return loop;
+		}
+
+		for(size_t c = 0; c < Counters.size(); c++) {
+			const uint8_t difference = uint8_t(read.counters[c] - previous.counters[c]);
+			if(!difference) continue;
+			if(loop.counter != NoCounter || (difference != 0x01 && difference != 0xff)) {
+				return loop;
+			}
+			loop.counter = int(c);
+			loop.delta = difference == 0x01 ? 1 : -1;
+		}
+
+		// Flags are permitted to change only as a function of the counter.
+		loop.flags_follow_counter =
+			loop.counter != NoCounter &&
+			read.flags == counter_flags(read.counters[size_t(loop.counter)], loop.delta, previous.flags);
+		if(!loop.flags_follow_counter && read.flags != previous.flags) {
+			return loop;
+		}
+
+		loop.is_valid = true;
+		return loop;
+	}
+
+	/// @returns The flags that an INC, if @c delta is positive, or a DEC, otherwise, would produce upon
+	/// arriving at @c value, given that the flags were previously @c flags.
+	static uint8_t counter_flags(const uint8_t value, const int delta, const uint8_t flags) {
+		using Flag = CPU::Z80::Flag;
+		uint8_t result =
+			(flags & Flag::Carry) |
+			(value & (Flag::Sign | Flag::Bit5 | Flag::Bit3)) |
+			(value ? 0 : Flag::Zero);
+		if(delta > 0) {
+			if(!(value & 0x0f)) result |= Flag::HalfCarry;
+			if(value == 0x80) result |= Flag::Overflow;
+		} else {
+			result |= Flag::Subtract;
+			if((value & 0x0f) == 0x0f) result |= Flag::HalfCarry;
+			if(value == 0x7f) result |= Flag::Overflow;
+		}
+		return result;
+	}
+
+	Cycles::IntType time_ = 0;
+	Read previous_;
+	Loop loop_, recognised_;
+	int confidence_ = 0;
+	bool is_ending_ = false;
+	bool has_side_effects_ = false;
+};
+
+}
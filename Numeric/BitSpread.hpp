@@ -23,6 +23,19 @@ constexpr uint16_t spread_bits(const uint8_t input) {
 	return (result | (result << 1)) & 0x5555;		// 0a0b 0c0d 0e0f 0g0h
 }
 
+/// @returns The bits of @c input each moved to the bottom of its own nibble,
+/// keeping the least-significant bit in its original position.
+///
+/// i.e. if @c input is abcdefgh then the result is 000a 000b 000c 000d 000e 000f 000g 000h.
+/// So planar graphics can be converted to chunky by ORing together the spread bit planes,
+/// each shifted left by its plane index.
+constexpr uint32_t spread_nibbles(const uint8_t input) {
+	uint32_t result = uint32_t(input);					// 0000 0000 0000 0000 0000 0000 abcd efgh
+	result = (result | (result << 12)) & 0x000f'000f;	// 0000 0000 0000 abcd 0000 0000 0000 efgh
+	result = (result | (result << 6)) & 0x0303'0303;	// 0000 00ab 0000 00cd 0000 00ef 0000 00gh
+	return (result | (result << 3)) & 0x1111'1111;		// 000a 000b 000c 000d 000e 000f 000g 000h
+}
+
 /// Performs the opposite action to @c spread_bits; given the 16-bit input
 /// @c abcd @c efgh @c ijkl @c mnop, returns the byte value @c bdfhjlnp
 /// i.e. every other bit is retained, keeping the least-significant bit in place.
@@ -29,22 +29,56 @@ struct Chipset {
 
 };
 
+namespace {
+
+/// Applies the write described by @c type and @c value to @c blitter if @c type names a Blitter register.
+/// @returns @c true if a register was written; @c false otherwise.
+bool apply_register_write(Amiga::Blitter<true> &blitter, NSString *type, NSInteger value) {
+	if([type isEqualToString:@"bltcon0"])	{ blitter.set_control(0, value);			return true; }
+	if([type isEqualToString:@"bltcon1"])	{ blitter.set_control(1, value);			return true; }
+	if([type isEqualToString:@"bltsize"])	{ blitter.set_size(value);					return true; }
+	if([type isEqualToString:@"bltafwm"])	{ blitter.set_first_word_mask(value);		return true; }
+	if([type isEqualToString:@"bltalwm"])	{ blitter.set_last_word_mask(value);		return true; }
+	if([type isEqualToString:@"bltadat"])	{ blitter.set_data(0, value);				return true; }
+	if([type isEqualToString:@"bltbdat"])	{ blitter.set_data(1, value);				return true; }
+	if([type isEqualToString:@"bltcdat"])	{ blitter.set_data(2, value);				return true; }
+	if([type isEqualToString:@"bltamod"])	{ blitter.set_modulo<0>(value);				return true; }
+	if([type isEqualToString:@"bltbmod"])	{ blitter.set_modulo<1>(value);				return true; }
+	if([type isEqualToString:@"bltcmod"])	{ blitter.set_modulo<2>(value);				return true; }
+	if([type isEqualToString:@"bltdmod"])	{ blitter.set_modulo<3>(value);				return true; }
+	if([type isEqualToString:@"bltaptl"])	{ blitter.set_pointer<0, 0>(value);			return true; }
+	if([type isEqualToString:@"bltbptl"])	{ blitter.set_pointer<1, 0>(value);			return true; }
+	if([type isEqualToString:@"bltcptl"])	{ blitter.set_pointer<2, 0>(value);			return true; }
+	if([type isEqualToString:@"bltdptl"])	{ blitter.set_pointer<3, 0>(value);			return true; }
+	if([type isEqualToString:@"bltapth"])	{ blitter.set_pointer<0, 16>(value);		return true; }
+	if([type isEqualToString:@"bltbpth"])	{ blitter.set_pointer<1, 16>(value);		return true; }
+	if([type isEqualToString:@"bltcpth"])	{ blitter.set_pointer<2, 16>(value);		return true; }
+	if([type isEqualToString:@"bltdpth"])	{ blitter.set_pointer<3, 16>(value);		return true; }
+	return false;
+}
+
+}
+
 @interface AmigaBlitterTests: XCTestCase
 @end
 
 @implementation AmigaBlitterTests
 
-- (void)testCase:(NSString *)name capturedAllBusActivity:(BOOL)capturedAllBusActivity {
-	uint16_t ram[256 * 1024]{};
-	Amiga::Chipset nonChipset;
-	Amiga::Blitter<true> blitter(nonChipset, ram, 256 * 1024);
-
+- (NSArray *)traceNamed:(NSString *)name {
 	NSString *const tracePath = [[NSBundle bundleForClass:[self class]]
 		pathForResource:name ofType:@"json.gz" inDirectory:@"Amiga Blitter Tests"];
 	NSData *const traceData = [NSData dataWithContentsOfGZippedFile:tracePath];
 	NSError *error;
 	NSArray *const trace = [NSJSONSerialization JSONObjectWithData:traceData options:0 error:&error];
 	XCTAssertNotNil(trace, @"JSON decoding failed with error %@", error);
+	return trace;
+}
+
+- (void)testCase:(NSString *)name capturedAllBusActivity:(BOOL)capturedAllBusActivity {
+	uint16_t ram[256 * 1024]{};
+	Amiga::Chipset nonChipset;
+	Amiga::Blitter<true> blitter(nonChipset, ram, 256 * 1024);
+	NSArray *const trace = [self traceNamed:name];
 
 	using TransactionType = Amiga::Blitter<true>::Transaction::Type;
 
@@ -75,90 +109,7 @@ struct Chipset {
 			}
 		}
 
-		if([type isEqualToString:@"bltcon0"]) {
-			blitter.set_control(0, param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltcon1"]) {
-			blitter.set_control(1, param1);
-			continue;
-		}
-
-		if([type isEqualToString:@"bltsize"]) {
-			blitter.set_size(param1);
-			continue;
-		}
-
-		if([type isEqualToString:@"bltafwm"]) {
-			blitter.set_first_word_mask(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltalwm"]) {
-			blitter.set_last_word_mask(param1);
-			continue;
-		}
-
-		if([type isEqualToString:@"bltadat"]) {
-			blitter.set_data(0, param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltbdat"]) {
-			blitter.set_data(1, param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltcdat"]) {
-			blitter.set_data(2, param1);
-			continue;
-		}
-
-		if([type isEqualToString:@"bltamod"]) {
-			blitter.set_modulo<0>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltbmod"]) {
-			blitter.set_modulo<1>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltcmod"]) {
-			blitter.set_modulo<2>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltdmod"]) {
-			blitter.set_modulo<3>(param1);
-			continue;
-		}
-
-		if([type isEqualToString:@"bltaptl"]) {
-			blitter.set_pointer<0, 0>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltbptl"]) {
-			blitter.set_pointer<1, 0>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltcptl"]) {
-			blitter.set_pointer<2, 0>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltdptl"]) {
-			blitter.set_pointer<3, 0>(param1);
-			continue;
-		}
-
-		if([type isEqualToString:@"bltapth"]) {
-			blitter.set_pointer<0, 16>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltbpth"]) {
-			blitter.set_pointer<1, 16>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltcpth"]) {
-			blitter.set_pointer<2, 16>(param1);
-			continue;
-		}
-		if([type isEqualToString:@"bltdpth"]) {
-			blitter.set_pointer<3, 16>(param1);
+		if(apply_register_write(blitter, type, param1)) {
 			continue;
 		}
 
@@ -275,6 +226,80 @@ struct Chipset {
 	[self testCase:@"Spindizzy Worlds" capturedAllBusActivity:YES];
 }
 
+/// Runs all blits in the capture @c name with RAM seeded from each address's first read, either
+/// completing each immediately or slot by slot; @returns all non-skipped bus transactions that occurred.
+- (std::vector<Amiga::Blitter<true>::Transaction>)transactionsForCase:(NSString *)name completeImmediately:(BOOL)completeImmediately ram:(uint16_t *)ram {
+	Amiga::Chipset nonChipset;
+	Amiga::Blitter<true> blitter(nonChipset, ram, 256 * 1024);
+	std::vector<Amiga::Blitter<true>::Transaction> result;
+	NSArray *const trace = [self traceNamed:name];
+
+	// Seed RAM.
+	std::unordered_map<NSInteger, bool> seen;
+	for(NSArray *const event in trace) {
+		NSString *const type = event[0];
+		const NSInteger address = [event[1] integerValue] >> 1;
+		if([type isEqualToString:@"write"]) {
+			seen[address] = true;
+		} else if(([type isEqualToString:@"cread"] || [type isEqualToString:@"bread"] || [type isEqualToString:@"aread"]) && !seen[address]) {
+			seen[address] = true;
+			ram[address] = [event[2] integerValue];
+		}
+	}
+
+	const auto complete = [&] {
+		while(blitter.get_status() & 0x4000) {
+			if(completeImmediately) {
+				blitter.advance_dma<true>();
+			} else {
+				blitter.advance_dma<false>();
+			}
+		}
+		for(const auto &transaction: blitter.get_and_reset_transactions()) {
+			if(transaction.type != Amiga::Blitter<true>::Transaction::Type::SkippedSlot) {
+				result.push_back(transaction);
+			}
+		}
+	};
+
+	// Perform blits.
+	for(NSArray *const event in trace) {
+		NSString *const type = event[0];
+		const NSInteger param1 = [event[1] integerValue];
+		complete();
+
+		apply_register_write(blitter, type, param1);
+	}
+	complete();
+
+	return result;
+}
+
+- (void)testImmediateCompletion {
+	// Immediate completion should have exactly the same effect, and produce the same
+	// sequence of bus transactions, as slot-by-slot blitting.
+	for(NSString *name in @[
+		@"gadget toggle", @"icon highlight", @"kickstart13 boot logo", @"sector decode",
+		@"window drag", @"window resize", @"RAM disk open", @"spots", @"inclusive fills",
+		@"Spindizzy Worlds"
+	]) {
+		std::vector<uint16_t> slot_ram(256 * 1024), immediate_ram(256 * 1024);
+		const auto slot_transactions = [self transactionsForCase:name completeImmediately:NO ram:slot_ram.data()];
+		const auto immediate_transactions = [self transactionsForCase:name completeImmediately:YES ram:immediate_ram.data()];
+
+		XCTAssert(slot_ram == immediate_ram, @"RAM contents differ for %@", name);
+		XCTAssertEqual(slot_transactions.size(), immediate_transactions.size(), @"Transaction counts differ for %@", name);
+		for(size_t c = 0; c < std::min(slot_transactions.size(), immediate_transactions.size()); c++) {
+			const auto &lhs = slot_transactions[c];
+			const auto &rhs = immediate_transactions[c];
+			if(lhs.type != rhs.type || lhs.address != rhs.address || lhs.value != rhs.value) {
+				XCTAssert(false, @"Transaction %zu differs for %@: %s vs %s", c, name, lhs.to_string().c_str(), rhs.to_string().c_str());
+				break;
+			}
+		}
+	}
+}
+
 - (void)testSequencer {
 	// These patterns are faithfully transcribed from the HRM's
 	// 'Pipeline Register' section, as captured online at
@@ -8,119 +8,46 @@
 
 #import <XCTest/XCTest.h>
 
-#include <array>
 #include <cassert>
 
 #include "CSL.hpp"
 #include "AmstradCPC.hpp"
 #include "Analyser/Static/AmstradCPC/Target.hpp"
 #include "Machines/AmstradCPC/Keyboard.hpp"
-#include "Outputs/ScanTarget.hpp"
+#include "Storage/Automation/CPCScanTarget.hpp"
 #include "CSROMFetcher.hpp"
 #include "TimedMachine.hpp"
 #include "MediaTarget.hpp"
 #include "KeyboardMachine.hpp"
 #include "MachineForTarget.hpp"
 
-struct ScanTarget: public Outputs::Display::ScanTarget {
-	void set_modals(const Modals modals) override {
-		modals_ = modals;
+using ScanTarget = Storage::Automation::CPCScanTarget;
+
+NSBitmapImageRep *image_representation(const ScanTarget &scan_target) {
+	NSBitmapImageRep *const result =
+		[[NSBitmapImageRep alloc]
+			initWithBitmapDataPlanes:NULL
+			pixelsWide:ScanTarget::ImageWidth
+			pixelsHigh:ScanTarget::ImageHeight
+			bitsPerSample:8
+			samplesPerPixel:4
+			hasAlpha:YES
+			isPlanar:NO
+			colorSpaceName:NSDeviceRGBColorSpace
+			bytesPerRow:4 * ScanTarget::ImageWidth
+			bitsPerPixel:0];
+	uint8_t *const data = result.bitmapData;
+
+	const auto &image = scan_target.image();
+	for(int c = 0; c < ScanTarget::ImageWidth * ScanTarget::ImageHeight; c++) {
+		data[c * 4 + 0] = ((image[c] >> 4) & 3) * 127;
+		data[c * 4 + 1] = ((image[c] >> 2) & 3) * 127;
+		data[c * 4 + 2] = ((image[c] >> 0) & 3) * 127;
+		data[c * 4 + 3] = 0xff;
 	}
-	Scan *begin_scan() override {
-		return &scan_;
-	}
-	uint8_t *begin_data(size_t, size_t) override {
-		return data_.data();
-	}
-
-
-	void end_scan() override {
-		// Empirical, CPC-specific observation: x positions end up
-		// being multiplied by 61 compared to a 1:1 pixel sampling at
-		// the CPC's highest resolution.
-		const int WidthDivider = 61;
-
-		const int src_pixels = scan_.end_points[1].data_offset - scan_.end_points[0].data_offset;
-		const int dst_pixels = (scan_.end_points[1].x - scan_.end_points[0].x) / WidthDivider;
-
-		const auto x1 = scan_.end_points[0].x / WidthDivider;
-		const auto x2 = scan_.end_points[1].x / WidthDivider;
-
-		uint8_t *const line = &raw_image_[line_ * ImageWidth];
-		if(x_ < x1) {
-			std::fill(&line[x_], &line[x1], 0);
-		}
-
-		if(x2 != x1) {
-			const int step = (src_pixels << 16) / dst_pixels;
-			int position = 0;
-
-			for(int x = x1; x < x2; x++) {
-				line[x] = data_[position >> 16];
-				position += step;
-			}
-		}
-		x_ = x2;
-	}
-	void announce(const Event event, bool, const Scan::EndPoint &, uint8_t) override {
-		switch(event) {
-			case Event::EndHorizontalRetrace: {
-				if(line_ == ImageHeight - 1) break;
-
-				if(x_ < ImageWidth) {
-					uint8_t *const line = &raw_image_[line_ * ImageWidth];
-					std::fill(&line[x_], &line[ImageWidth], 0);
-				}
 
-				++line_;
-				x_ = 0;
-			} break;
-			case Event::EndVerticalRetrace:
-				std::fill(raw_image_.begin() + (line_ * ImageWidth), raw_image_.end(), 0);
-				line_ = 0;
-				x_ = 0;
-			break;
-			default: break;
-		}
-	}
-
-	NSBitmapImageRep *image_representation() {
-		NSBitmapImageRep *const result =
-			[[NSBitmapImageRep alloc]
-				initWithBitmapDataPlanes:NULL
-				pixelsWide:ImageWidth
-				pixelsHigh:ImageHeight
-				bitsPerSample:8
-				samplesPerPixel:4
-				hasAlpha:YES
-				isPlanar:NO
-				colorSpaceName:NSDeviceRGBColorSpace
-				bytesPerRow:4 * ImageWidth
-				bitsPerPixel:0];
-		uint8_t *const data = result.bitmapData;
-
-		for(int c = 0; c < ImageWidth * ImageHeight; c++) {
-			data[c * 4 + 0] = ((raw_image_[c] >> 4) & 3) * 127;
-			data[c * 4 + 1] = ((raw_image_[c] >> 2) & 3) * 127;
-			data[c * 4 + 2] = ((raw_image_[c] >> 0) & 3) * 127;
-			data[c * 4 + 3] = 0xff;
-		}
-
-		return result;
-	}
-
-
-private:
-	Modals modals_;
-	Scan scan_;
-	std::array<uint8_t, 2048> data_;
-	int line_ = 0;
-	int x_ = 0;
-
-	static constexpr int ImageWidth = 914;
-	static constexpr int ImageHeight = 312;
-	std::array<uint8_t, ImageWidth*ImageHeight> raw_image_;
-};
+	return result;
+}
 
 struct SSMDelegate: public AmstradCPC::Machine::SSMDelegate {
 	SSMDelegate(ScanTarget &scan_target) : scan_target_(scan_target) {
@@ -140,7 +67,7 @@ struct SSMDelegate: public AmstradCPC::Machine::SSMDelegate {
 		}
 
 		NSData *const data =
-			[scan_target_.image_representation() representationUsingType:NSPNGFileType properties:@{}];
+			[image_representation(scan_target_) representationUsingType:NSPNGFileType properties:@{}];
 		NSString *const name =
 			[temp_dir_ stringByAppendingPathComponent:[NSString stringWithFormat:@"CLK_%d_%04x.png", crtc_, code]];
 		[data
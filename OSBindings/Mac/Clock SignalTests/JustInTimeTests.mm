@@ -0,0 +1,72 @@
+//
+//  JustInTimeTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "ClockReceiver/JustInTime.hpp"
+
+#include <random>
+
+namespace {
+
+/// Records the total time it has been run for, and announces a sequence point at every multiple of @c Period.
+struct Accumulator {
+	static constexpr int Period = 1000;
+
+	void run_for(const HalfCycles duration) {
+		total += duration;
+	}
+
+	HalfCycles next_sequence_point() const {
+		return HalfCycles(Period - total.as<int>() % Period);
+	}
+
+	HalfCycles total;
+};
+
+}
+
+@interface JustInTimeTests : XCTestCase
+@end
+
+@implementation JustInTimeTests
+
+/// Feeds the same sequence of time to a synchronous and an asynchronous actor, checking that both
+/// flush at the same sequence points and that their objects agree on total time whenever accessed.
+- (void)testAsyncMatchesSynchronous {
+	JustInTimeActor<Accumulator> synchronous;
+	AsyncJustInTimeActor<Accumulator> asynchronous(HalfCycles(64), HalfCycles(4096));
+
+	std::mt19937 generator(1981);
+	std::uniform_int_distribution<int> lengths(1, 40);
+	int total = 0;
+
+	for(int c = 0; c < 1'000'000; c++) {
+		const HalfCycles length(lengths(generator));
+		total += length.as<int>();
+
+		const bool synchronous_flushed = synchronous += length;
+		const bool asynchronous_flushed = asynchronous += length;
+		XCTAssertEqual(synchronous_flushed, asynchronous_flushed);
+		if(synchronous_flushed) {
+			XCTAssertEqual(synchronous.get()->total.as<int>(), asynchronous.get()->total.as<int>());
+		}
+
+		if(!(c % 997)) {
+			XCTAssertEqual(synchronous->total.as<int>(), total);
+			XCTAssertEqual(asynchronous->total.as<int>(), total);
+		}
+	}
+
+	synchronous.flush();
+	asynchronous.flush();
+	XCTAssertEqual(synchronous.get()->total.as<int>(), total);
+	XCTAssertEqual(asynchronous.get()->total.as<int>(), total);
+}
+
+@end
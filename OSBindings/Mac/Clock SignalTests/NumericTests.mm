@@ -8,6 +8,7 @@
 
 #import <XCTest/XCTest.h>
 
+#include "BitSpread.hpp"
 #include "BitStream.hpp"
 
 @interface NumericTests : XCTestCase
@@ -79,4 +80,13 @@
 	XCTAssertEqual(stream.next<3>(), 0b011);
 }
 
+- (void)testSpreadNibbles {
+	XCTAssertEqual(Numeric::spread_nibbles(0x00), 0x0000'0000);
+	XCTAssertEqual(Numeric::spread_nibbles(0xff), 0x1111'1111);
+	XCTAssertEqual(Numeric::spread_nibbles(0x80), 0x1000'0000);
+	XCTAssertEqual(Numeric::spread_nibbles(0x01), 0x0000'0001);
+	XCTAssertEqual(Numeric::spread_nibbles(0xa5), 0x1010'0101);
+	XCTAssertEqual(Numeric::spread_nibbles(0x3c), 0x0011'1100);
+}
+
 @end
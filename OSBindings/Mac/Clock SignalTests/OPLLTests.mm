@@ -0,0 +1,157 @@
+//
+//  OPLLTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "Components/OPx/OPLL.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+constexpr int Segments = 64;
+
+/// Segment length at an audio divider of 4, i.e. with one sample per channel slot; 256 updates of all channels.
+constexpr int SegmentLength = 18 * 256;
+
+/// The recording holds every eleventh sample, which is coprime with the 18 channel slots so that
+/// each slot is sampled in turn.
+constexpr int RecordingInterval = 11;
+
+/// The snare and high-hat mix in noise from an LFSR that is seeded via rand(), which differs between C libraries,
+/// so the slots that they may occupy at an audio divider of 4 aren't compared with the recording.
+constexpr bool is_noise_slot(const size_t sample) {
+	switch(sample % 18) {
+		case 0: case 6: case 13: case 16:	return true;
+		default:							return false;
+	}
+}
+
+/// A linear congruential generator, so that the script is identical on every platform.
+struct Random {
+	uint32_t next() {
+		state_ = state_ * 1664525 + 1013904223;
+		return state_ >> 8;
+	}
+
+private:
+	uint32_t state_ = 1;
+};
+
+/// Plays a fixed script of register writes at the supplied audio divider and returns all output. Each segment
+/// makes at most one write, then renders @c SegmentLength samples' worth of time in chunks of the lengths
+/// supplied by @c chunk_length.
+template <typename ChunkLengthT> std::vector<int16_t> play(const int audio_divider, ChunkLengthT chunk_length) {
+	// Seed the noise generator identically for every play.
+	srand(1);
+
+	Concurrency::AsyncTaskQueue<false> queue;
+	Yamaha::OPL::OPLL opll(queue, audio_divider);
+	Random random;
+
+	const auto write = [&](const int address, const uint32_t value) {
+		opll.write(0, uint8_t(address));
+		opll.write(1, uint8_t(value));
+	};
+
+	opll.set_sample_volume_range(32767);
+	for(int c = 0; c < 8; c++) {
+		write(c, random.next());
+	}
+	for(int c = 0; c < 9; c++) {
+		write(0x10 + c, random.next());
+		write(0x30 + c, random.next());
+		write(0x20 + c, random.next() | 0x10);
+	}
+
+	const int segment_length = SegmentLength * 4 / audio_divider;
+	std::vector<int16_t> output(size_t(Segments * segment_length));
+	for(int segment = 0; segment < Segments; segment++) {
+		const int channel = int(random.next() % 9);
+		switch(random.next() % 8) {
+			case 0:	write(int(random.next() % 8), random.next());	break;	// Custom instrument.
+			case 1:	write(0x0e, random.next() & 0x3f);				break;	// Rhythm mode and keys.
+			case 2:	write(0x10 + channel, random.next());			break;	// Frequency.
+			case 3:
+			case 4:	write(0x20 + channel, random.next());			break;	// Key, sustain, octave.
+			case 5:	write(0x30 + channel, random.next());			break;	// Instrument and volume.
+			default: break;
+		}
+		queue.lock_flush();
+
+		int offset = 0;
+		while(offset < segment_length) {
+			const int length = std::min(segment_length - offset, chunk_length());
+			opll.apply_samples<Outputs::Speaker::Action::Store>(
+				size_t(length),
+				&output[size_t(segment * segment_length + offset)]
+			);
+			offset += length;
+		}
+	}
+
+	return output;
+}
+
+}
+
+@interface OPLLTests : XCTestCase
+@end
+
+@implementation OPLLTests
+
+/// Output matches, exactly, a recording made with the OPLL as it was before it emitted runs of samples,
+/// when it tested for an update and computed the current slot for every sample.
+- (void)testMatchesPerSampleRecording {
+	NSString *const path = [[NSBundle bundleForClass:[self class]]
+		pathForResource:@"per_sample_output" ofType:@"raw" inDirectory:@"OPLL Tests"];
+	NSData *const recording = [NSData dataWithContentsOfFile:path];
+	XCTAssertNotNil(recording);
+
+	Random chunk_random;
+	const auto output = play(4, [&] {
+		return 1 + int(chunk_random.next() % 200);
+	});
+	XCTAssertEqual(recording.length, (output.size() + RecordingInterval - 1) / RecordingInterval * sizeof(int16_t));
+
+	const auto recorded = static_cast<const int16_t *>(recording.bytes);
+	for(size_t c = 0; c < recording.length / sizeof(int16_t); c++) {
+		if(is_noise_slot(c * RecordingInterval)) continue;
+
+		const int16_t sample = output[c * RecordingInterval];
+		if(sample != recorded[c]) {
+			XCTFail(@"Sample %zu is %d; recorded value was %d", c * RecordingInterval, sample, recorded[c]);
+			break;
+		}
+	}
+}
+
+/// Lower audio dividers hold each channel slot for proportionally more samples, but otherwise produce the same output.
+- (void)testDividersRepeatSlots {
+	const auto reference = play(4, [] { return 1; });
+
+	for(const int divider: {1, 2}) {
+		Random chunk_random;
+		const auto output = play(divider, [&] {
+			return 1 + int(chunk_random.next() % 200);
+		});
+
+		const int repeats = 4 / divider;
+		XCTAssertEqual(output.size(), reference.size() * size_t(repeats));
+		for(size_t c = 0; c < output.size(); c++) {
+			if(output[c] != reference[c / size_t(repeats)]) {
+				XCTFail(@"Sample %zu at divider %d is %d; expected %d", c, divider, output[c], reference[c / size_t(repeats)]);
+				break;
+			}
+		}
+	}
+}
+
+@end
@@ -0,0 +1,115 @@
+//
+//  PackedStructTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "Reflection/Struct.hpp"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Child: public Reflection::StructImpl<Child> {
+	uint16_t word = 0;
+	std::string name;
+
+private:
+	friend Reflection::StructImpl<Child>;
+	void declare_fields() {
+		DeclareField(word);
+		DeclareField(name);
+	}
+};
+
+struct Parent: public Reflection::StructImpl<Parent> {
+	int integer = 0;
+	double real = 0.0;
+	bool flag = false;
+	uint8_t bytes[5]{};
+	std::vector<uint8_t> data;
+	Child child;
+
+private:
+	friend Reflection::StructImpl<Parent>;
+	void declare_fields() {
+		DeclareField(integer);
+		DeclareField(real);
+		DeclareField(flag);
+		DeclareField(bytes);
+		DeclareField(data);
+		DeclareField(child);
+	}
+};
+
+Parent populated_parent() {
+	Parent parent;
+	parent.integer = -123456;
+	parent.real = 3.25;
+	parent.flag = true;
+	for(uint8_t c = 0; c < 5; c++) {
+		parent.bytes[c] = uint8_t(c * 17 + 3);
+	}
+	parent.data = {0x00, 0xff, 0x7f, 0x80};
+	parent.child.word = 0xbeef;
+	parent.child.name = "Clock Signal";
+	return parent;
+}
+
+}
+
+@interface PackedStructTests : XCTestCase
+@end
+
+@implementation PackedStructTests
+
+- (void)testRoundTrip {
+	const Parent source = populated_parent();
+	const auto packed = source.serialise_packed();
+
+	Parent target;
+	XCTAssert(target.deserialise_packed(packed));
+
+	XCTAssertEqual(target.integer, source.integer);
+	XCTAssertEqual(target.real, source.real);
+	XCTAssertEqual(target.flag, source.flag);
+	for(size_t c = 0; c < 5; c++) {
+		XCTAssertEqual(target.bytes[c], source.bytes[c]);
+	}
+	XCTAssert(target.data == source.data);
+	XCTAssertEqual(target.child.word, source.child.word);
+	XCTAssert(target.child.name == source.child.name);
+
+	XCTAssert(target.serialise_packed() == packed);
+}
+
+- (void)testTruncatedDataIsRejected {
+	auto packed = populated_parent().serialise_packed();
+	packed.pop_back();
+
+	Parent target;
+	XCTAssertFalse(target.deserialise_packed(packed));
+}
+
+- (void)testTrailingDataIsRejected {
+	auto packed = populated_parent().serialise_packed();
+	packed.push_back(0);
+
+	Parent target;
+	XCTAssertFalse(target.deserialise_packed(packed));
+}
+
+- (void)testOtherSchemaIsRejected {
+	Child child;
+	child.name = "Child";
+
+	Parent target;
+	XCTAssertFalse(target.deserialise_packed(child.serialise_packed()));
+}
+
+@end
@@ -0,0 +1,132 @@
+//
+//  SIDTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "Components/SID/SID.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+constexpr int Segments = 64;
+constexpr int SegmentLength = 512;
+
+/// The recording holds every eighth sample.
+constexpr int RecordingInterval = 8;
+
+/// The SID's filters use floating point, so permit small differences in rounding between platforms.
+constexpr int Tolerance = 4;
+
+/// A linear congruential generator, so that the script is identical on every platform.
+struct Random {
+	uint32_t next() {
+		state_ = state_ * 1664525 + 1013904223;
+		return state_ >> 8;
+	}
+
+private:
+	uint32_t state_ = 1;
+};
+
+/// Plays a fixed script of register writes and returns all output. Each segment reprograms one voice,
+/// and sometimes the filter, then renders @c SegmentLength samples in chunks of the lengths supplied by @c chunk_length.
+template <typename ChunkLengthT> std::vector<int16_t> play(ChunkLengthT chunk_length) {
+	Concurrency::AsyncTaskQueue<false> queue;
+	MOS::SID::SID sid(queue);
+	Random random;
+
+	sid.set_sample_volume_range(32767);
+	for(int c = 0; c < 25; c++) {
+		sid.write(c, uint8_t(random.next()));
+	}
+
+	std::vector<int16_t> output(Segments * SegmentLength);
+	for(int segment = 0; segment < Segments; segment++) {
+		const int voice = int(random.next() % 3) * 7;
+		for(int c = 0; c < 4; c++) {
+			sid.write(voice + c, uint8_t(random.next()));
+		}
+		if(random.next() & 1) {
+			sid.write(voice + 5, uint8_t(random.next()));
+			sid.write(voice + 6, uint8_t(random.next()));
+		}
+
+		// Set the test bit only occasionally, as it silences the voice.
+		const uint32_t control = random.next();
+		sid.write(voice + 4, uint8_t((control & 0xf7) | ((control % 16) ? 0x00 : 0x08)));
+
+		if(!(random.next() & 3)) {
+			sid.write(0x15, uint8_t(random.next()));
+			sid.write(0x16, uint8_t(random.next()));
+			sid.write(0x17, uint8_t(random.next()));
+			sid.write(0x18, uint8_t(random.next() | 0x0f));
+		}
+		queue.lock_flush();
+
+		int offset = 0;
+		while(offset < SegmentLength) {
+			const int length = std::min(SegmentLength - offset, chunk_length());
+			sid.apply_samples<Outputs::Speaker::Action::Store>(
+				size_t(length),
+				&output[size_t(segment * SegmentLength + offset)]
+			);
+			offset += length;
+		}
+	}
+
+	return output;
+}
+
+}
+
+@interface SIDTests : XCTestCase
+@end
+
+@implementation SIDTests
+
+/// Output matches a recording made with the SID as it was before it rendered in blocks,
+/// when it produced one sample at a time.
+- (void)testMatchesPerSampleRecording {
+	NSString *const path = [[NSBundle bundleForClass:[self class]]
+		pathForResource:@"per_sample_output" ofType:@"raw" inDirectory:@"SID Tests"];
+	NSData *const recording = [NSData dataWithContentsOfFile:path];
+	XCTAssertNotNil(recording);
+	XCTAssertEqual(recording.length, Segments * SegmentLength / RecordingInterval * sizeof(int16_t));
+
+	Random chunk_random;
+	const auto output = play([&] {
+		return 1 + int(chunk_random.next() % 200);
+	});
+
+	const auto recorded = static_cast<const int16_t *>(recording.bytes);
+	for(size_t c = 0; c < recording.length / sizeof(int16_t); c++) {
+		const int16_t sample = output[c * RecordingInterval];
+		if(std::abs(sample - recorded[c]) > Tolerance) {
+			XCTFail(@"Sample %zu is %d; recorded value was %d", c * RecordingInterval, sample, recorded[c]);
+			break;
+		}
+	}
+}
+
+/// Output is the same whether samples are requested one at a time or a segment at a time.
+- (void)testOutputIsIndependentOfRequestLength {
+	const auto per_sample = play([] { return 1; });
+	const auto per_segment = play([] { return SegmentLength; });
+
+	const auto mismatch = std::mismatch(per_sample.begin(), per_sample.end(), per_segment.begin());
+	XCTAssert(
+		mismatch.first == per_sample.end(),
+		@"Output differs from sample %ld",
+		long(mismatch.first - per_sample.begin())
+	);
+}
+
+@end
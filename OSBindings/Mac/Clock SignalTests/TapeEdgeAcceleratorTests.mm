@@ -0,0 +1,188 @@
+//
+//  TapeEdgeAcceleratorTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "Machines/Utility/TapeEdgeAccelerator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr int ClockRate = 3'500'000;
+constexpr int Edges = 150;
+
+/// A tape of alternating high and low pulses, of assorted lengths.
+class PulseTape: public Storage::Tape::Tape {
+private:
+	std::unique_ptr<Storage::Tape::FormatSerialiser> format_serialiser() const override {
+		return std::make_unique<Serialiser>();
+	}
+
+	struct Serialiser: public Storage::Tape::FormatSerialiser {
+		Storage::Tape::Pulse next_pulse() override {
+			using Pulse = Storage::Tape::Pulse;
+			++pulse_;
+			return Pulse(
+				pulse_ & 1 ? Pulse::High : Pulse::Low,
+				Storage::Time(1500 + (pulse_ * 397) % 2000, ClockRate)
+			);
+		}
+		void reset() override {
+			pulse_ = 0;
+		}
+		bool is_at_end() const override {
+			return pulse_ >= Edges * 2;
+		}
+
+		int pulse_ = 0;
+	};
+};
+
+/// @returns A program that counts iterations of a polling loop between tape edges, storing each
+/// count from 0x8000 onwards; @c extra is inserted into the loop body ahead of the read.
+std::vector<uint8_t> program(const std::vector<uint8_t> &extra) {
+	std::vector<uint8_t> result = {
+		0xf3,				// DI
+		0x31, 0x00, 0xff,	// LD SP, 0xff00
+		0x21, 0x00, 0x80,	// LD HL, 0x8000
+		0xdb, 0xfe,			// IN A, (0xfe)
+		0xe6, 0x80,			// AND 0x80
+		0x4f,				// LD C, A
+	};
+
+	const auto next = result.size();
+	result.insert(result.end(), {0x06, 0x00});			// next: LD B, 0
+
+	const auto loop = result.size();
+	result.push_back(0x04);								// loop: INC B
+	result.insert(result.end(), extra.begin(), extra.end());
+	result.insert(result.end(), {0xdb, 0xfe, 0xa9, 0xe6, 0x80, 0x28});	// IN A, (0xfe); XOR C; AND 0x80; JR Z, loop
+	result.push_back(uint8_t(loop - (result.size() + 1)));
+
+	result.insert(result.end(), {0xa9, 0x4f, 0x70, 0x23, 0x18});		// XOR C; LD C, A; LD (HL), B; INC HL; JR next
+	result.push_back(uint8_t(next - (result.size() + 1)));
+
+	return result;
+}
+
+struct Result {
+	std::vector<uint8_t> counts;
+	int reads = 0;
+};
+
+struct Machine: public CPU::Z80::BusHandler {
+	Machine(const bool accelerate, const std::vector<uint8_t> &program) : z80_(*this), tape_(ClockRate * 2), accelerate_(accelerate) {
+		// The tape is run in half-cycles, so its input clock is twice the processor's.
+		std::copy(program.begin(), program.end(), ram_.begin());
+		z80_.set_value_of(CPU::Z80::Register::HL, 0x8000);
+		tape_.set_tape(std::make_shared<PulseTape>(), TargetPlatform::ZXSpectrum);
+		tape_.set_motor_control(true);
+	}
+
+	Result run() {
+		const auto counts = [&] {
+			return int(z80_.value_of(CPU::Z80::Register::HL)) - 0x8000;
+		};
+
+		// Allow a generous time limit, to catch any runaway.
+		for(int c = 0; c < 10'000 && counts() < Edges - 1; c++) {
+			z80_.run_for(HalfCycles(1000));
+		}
+
+		Result result;
+		result.counts.assign(ram_.begin() + 0x8000, ram_.begin() + 0x8000 + std::clamp(counts(), 0, Edges - 1));
+		result.reads = reads_;
+		return result;
+	}
+
+	HalfCycles perform_machine_cycle(const CPU::Z80::PartialMachineCycle &cycle) {
+		const auto length = cycle.length.as<int>();
+		tape_.run_for(Cycles(length));
+		accelerator_.run_for(Cycles(length));
+		accelerator_.did_perform(cycle);
+
+		using Operation = CPU::Z80::PartialMachineCycle::Operation;
+		switch(cycle.operation) {
+			case Operation::ReadOpcode:
+			case Operation::Read:
+				*cycle.value = ram_[*cycle.address];
+			break;
+			case Operation::Write:
+				ram_[*cycle.address] = *cycle.value;
+			break;
+			case Operation::Input:
+				*cycle.value = tape_.input() ? 0xff : 0x7f;
+				++reads_;
+				if(accelerate_) {
+					accelerator_.did_read_input(z80_, tape_);
+				}
+			break;
+			default: break;
+		}
+		return HalfCycles(0);
+	}
+
+private:
+	CPU::Z80::Processor<Machine, false, false> z80_;
+	Storage::Tape::BinaryTapePlayer tape_;
+	Utility::TapeEdgeAccelerator accelerator_;
+	const bool accelerate_;
+	int reads_ = 0;
+	std::array<uint8_t, 65536> ram_{};
+};
+
+Result run(const bool accelerate, const std::vector<uint8_t> &extra) {
+	auto machine = std::make_unique<Machine>(accelerate, program(extra));
+	return machine->run();
+}
+
+}
+
+@interface TapeEdgeAcceleratorTests : XCTestCase
+@end
+
+@implementation TapeEdgeAcceleratorTests
+
+/// A loop that changes only a counter, with the matching flags, is accelerated without
+/// changing the count that the program observes between each pair of edges.
+- (void)testCounterLoopIsAccelerated {
+	const auto normal = run(false, {});
+	const auto accelerated = run(true, {});
+
+	XCTAssertEqual(normal.counts.size(), Edges - 1);
+	XCTAssert(normal.counts == accelerated.counts);
+	XCTAssertLessThan(accelerated.reads * 2, normal.reads);
+}
+
+/// A loop that writes to memory isn't accelerated, as skipped iterations wouldn't perform their writes.
+- (void)testWritingLoopIsRejected {
+	const std::vector<uint8_t> write = {0x32, 0x00, 0x90};	// LD (0x9000), A
+	const auto normal = run(false, write);
+	const auto accelerated = run(true, write);
+
+	XCTAssertEqual(normal.counts.size(), Edges - 1);
+	XCTAssert(normal.counts == accelerated.counts);
+	XCTAssertEqual(accelerated.reads, normal.reads);
+}
+
+/// A loop that performs output isn't accelerated, for the same reason.
+- (void)testOutputtingLoopIsRejected {
+	const std::vector<uint8_t> output = {0xd3, 0xfd};	// OUT (0xfd), A
+	const auto normal = run(false, output);
+	const auto accelerated = run(true, output);
+
+	XCTAssertEqual(normal.counts.size(), Edges - 1);
+	XCTAssert(normal.counts == accelerated.counts);
+	XCTAssertEqual(accelerated.reads, normal.reads);
+}
+
+@end
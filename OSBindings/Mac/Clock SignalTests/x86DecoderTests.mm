@@ -329,6 +329,17 @@ decode(const std::initializer_list<uint8_t> &stream, bool set_32_bit = false) {
 	test_far(instructions[0], Operation::CALLfar, 0x7856, 0x3412);
 }
 
+- (void)testShiftAfterLES {
+	const auto instructions = decode<Model::i80286>({
+		0xc4, 0x04,		// les		(%si),%ax
+		0xd2, 0xe7,		// shl		%cl,%bh
+	});
+
+	XCTAssertEqual(instructions.size(), 2);
+	test(instructions[0], DataSize::Word, Operation::LES, ScaleIndexBase(Source::eSI), Source::eAX);
+	test(instructions[1], DataSize::Byte, Operation::SAL, Source::eCX, Source::BH);
+}
+
 - (void)testLDSLESEtc {
 	auto run_test = [](bool is_32, DataSize size) {
 		const auto instructions = decode<Model::i80386>({
@@ -23,6 +23,8 @@
 #include "Reflection/Enum.hpp"
 #include "Reflection/Struct.hpp"
 
+#include "Storage/Automation/CSLBatch.hpp"
+
 #include <algorithm>
 #include <array>
 #include <atomic>
@@ -553,7 +555,8 @@ int main(int argc, char *argv[]) {
 		" [--rompath={path to ROMs}]"
 		" [--speed={speed multiplier, e.g. 1.5}]"
 		" [--logical-keyboard]"
-		" [--volume={0.0 to 1.0}]";
+		" [--volume={0.0 to 1.0}]"
+		" [--csl-batch={directory of CSL scripts} [--output={directory}] [--threads={count}]]";
 
 	// Print a help message if requested.
 	if(
@@ -658,68 +661,6 @@ int main(int argc, char *argv[]) {
 		return EXIT_SUCCESS;
 	}
 
-	// Determine the machine for the supplied file, if any, or from --new.
-	Analyser::Static::TargetList targets;
-
-	const auto new_argument = arguments.selections.find("new");
-	std::string long_machine_name;
-	if(new_argument != arguments.selections.end() && !new_argument->second.empty()) {
-		// Perform for a case-insensitive search against short names.
-		const auto short_names = Machine::AllMachines(Machine::Type::DoesntRequireMedia, false);
-		auto short_name = short_names.begin();
-		while(short_name != short_names.end()) {
-			if(std::equal(
-				short_name->begin(), short_name->end(),
-				new_argument->second.begin(), new_argument->second.end(),
-				[](char a, char b) { return tolower(b) == tolower(a); })) {
-				break;
-			}
-			++short_name;
-		}
-
-		// If a match was found, use the corresponding long name to look up a suitable
-		// Analyser::Statuc::Target and move that to the targets list.
-		if(short_name != short_names.end()) {
-			long_machine_name = Machine::AllMachines(Machine::Type::DoesntRequireMedia, true)[short_name - short_names.begin()];
-			auto targets_by_machine = Machine::TargetsByMachineName(false);
-			std::unique_ptr<Analyser::Static::Target> tgt = std::move(targets_by_machine[long_machine_name]);
-			targets.push_back(std::move(tgt));
-		}
-	} else if(!arguments.file_names.empty()) {
-		// Take the first file name that actually implies a machine.
-		auto file_name = arguments.file_names.begin();
-		while(file_name != arguments.file_names.end() && targets.empty()) {
-			targets = Analyser::Static::GetTargets(*file_name);
-			++file_name;
-		}
-	}
-
-	if(targets.empty()) {
-		if(!arguments.file_names.empty()) {
-			std::cerr << "Cannot open ";
-			bool is_first = true;
-			for(const auto &name: arguments.file_names) {
-				if(!is_first) std::cerr << ", ";
-				is_first = false;
-				std::cerr << name;
-			}
-			std::cerr << "; no target machine found" << std::endl;
-			return EXIT_FAILURE;
-		}
-
-		if(!new_argument->second.empty()) {
-			std::cerr << "Unknown machine: " << new_argument->second << std::endl;
-			return EXIT_FAILURE;
-		}
-
-		std::cerr << "Usage: " << final_path_component(argv[0]) << usage_suffix << std::endl;
-		std::cerr << "Use --help to learn more about available options." << std::endl;
-		return EXIT_FAILURE;
-	}
-
-	MachineRunner machine_runner;
-	SpeakerDelegate speaker_delegate;
-
 	// For vanilla SDL purposes, assume system ROMs can be found in one of:
 	//
 	//	/usr/local/share/CLK/[system];
@@ -797,6 +738,103 @@ int main(int argc, char *argv[]) {
 			return results;
 		};
 
+	// If a directory of CSL scripts was supplied, run those headlessly and exit.
+	const auto csl_argument = arguments.selections.find("csl-batch");
+	if(csl_argument != arguments.selections.end()) {
+		const auto output_argument = arguments.selections.find("output");
+		const auto threads_argument = arguments.selections.find("threads");
+
+		const auto results = Storage::Automation::CSL::run_batch(
+			csl_argument->second,
+			output_argument != arguments.selections.end() ? output_argument->second : ".",
+			rom_fetcher,
+			threads_argument != arguments.selections.end() ? unsigned(atoi(threads_argument->second.c_str())) : 0
+		);
+
+		double emulated_seconds = 0.0, host_seconds = 0.0;
+		bool all_completed = true;
+		for(const auto &result: results) {
+			std::cout << result.script << ": " << (result.completed ? "completed" : "failed");
+			std::cout << " in " << result.host_seconds << "s; " << result.screenshots << " screenshot(s)";
+			for(const auto &note: result.notes) {
+				std::cout << "; " << note;
+			}
+			std::cout << std::endl;
+
+			emulated_seconds += result.emulated_seconds;
+			host_seconds += result.host_seconds;
+			all_completed &= result.completed;
+		}
+		std::cout << results.size() << " script(s); " << emulated_seconds << "s emulated in " << host_seconds << "s of processing." << std::endl;
+
+		if(!missing_roms.empty()) {
+			std::cerr << "Could not find system ROMs; please install to /usr/local/share/CLK/ or /usr/share/CLK/, or provide a --rompath, e.g. --rompath=~/ROMs." << std::endl;
+		}
+		return all_completed ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	// Determine the machine for the supplied file, if any, or from --new.
+	Analyser::Static::TargetList targets;
+
+	const auto new_argument = arguments.selections.find("new");
+	std::string long_machine_name;
+	if(new_argument != arguments.selections.end() && !new_argument->second.empty()) {
+		// Perform for a case-insensitive search against short names.
+		const auto short_names = Machine::AllMachines(Machine::Type::DoesntRequireMedia, false);
+		auto short_name = short_names.begin();
+		while(short_name != short_names.end()) {
+			if(std::equal(
+				short_name->begin(), short_name->end(),
+				new_argument->second.begin(), new_argument->second.end(),
+				[](char a, char b) { return tolower(b) == tolower(a); })) {
+				break;
+			}
+			++short_name;
+		}
+
+		// If a match was found, use the corresponding long name to look up a suitable
+		// Analyser::Statuc::Target and move that to the targets list.
+		if(short_name != short_names.end()) {
+			long_machine_name = Machine::AllMachines(Machine::Type::DoesntRequireMedia, true)[short_name - short_names.begin()];
+			auto targets_by_machine = Machine::TargetsByMachineName(false);
+			std::unique_ptr<Analyser::Static::Target> tgt = std::move(targets_by_machine[long_machine_name]);
+			targets.push_back(std::move(tgt));
+		}
+	} else if(!arguments.file_names.empty()) {
+		// Take the first file name that actually implies a machine.
+		auto file_name = arguments.file_names.begin();
+		while(file_name != arguments.file_names.end() && targets.empty()) {
+			targets = Analyser::Static::GetTargets(*file_name);
+			++file_name;
+		}
+	}
+
+	if(targets.empty()) {
+		if(!arguments.file_names.empty()) {
+			std::cerr << "Cannot open ";
+			bool is_first = true;
+			for(const auto &name: arguments.file_names) {
+				if(!is_first) std::cerr << ", ";
+				is_first = false;
+				std::cerr << name;
+			}
+			std::cerr << "; no target machine found" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		if(!new_argument->second.empty()) {
+			std::cerr << "Unknown machine: " << new_argument->second << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		std::cerr << "Usage: " << final_path_component(argv[0]) << usage_suffix << std::endl;
+		std::cerr << "Use --help to learn more about available options." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	MachineRunner machine_runner;
+	SpeakerDelegate speaker_delegate;
+
 	// Apply all command-line options to the targets.
 	for(auto &target: targets) {
 		auto reflectable_target = dynamic_cast<Reflection::Struct *>(target.get());
@@ -0,0 +1,100 @@
+//
+//  LineCache.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "CRT.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Outputs::CRT {
+
+/*!
+	Retains the most-recently generated pixels for each line of a display so that a video generator
+	can repeat them, rather than regenerating them, for as long as their sources are unchanged.
+
+	The owner is responsible for reporting changes in source data — via @c invalidate and
+	@c invalidate_all — and may supply a @c context for each line that captures any other
+	state that affects its output; a line whose context differs from that of its previous
+	generation is regenerated.
+
+	Lines are generated into the cache and then copied to the CRT with the same timing as
+	if they had been generated directly, so exact timing is unaffected.
+*/
+template <typename SampleT, size_t SamplesPerLine, size_t Lines>
+class LineCache {
+public:
+	/// Marks @c line as needing to be regenerated.
+	void invalidate(const size_t line) {
+		valid_[line] = false;
+	}
+
+	/// Marks lines [@c begin, @c end) as needing to be regenerated.
+	void invalidate(const size_t begin, const size_t end) {
+		std::fill(valid_.begin() + ptrdiff_t(begin), valid_.begin() + ptrdiff_t(end), false);
+	}
+
+	/// Marks all lines as needing to be regenerated.
+	void invalidate_all() {
+		valid_.fill(false);
+	}
+
+	/*!
+		Begins output of @c line.
+
+		@returns A pointer to storage for the line's samples, which should be written to only if
+			@c needs_generation returns @c true.
+	*/
+	template <typename TargetT = SampleT>
+	TargetT *begin_line(const size_t line, const uint32_t context = 0) {
+		line_ = line;
+		is_generating_ = !valid_[line] || contexts_[line] != context;
+		valid_[line] = true;
+		contexts_[line] = context;
+		return reinterpret_cast<TargetT *>(&samples_[line * SamplesPerLine]);
+	}
+
+	/*!
+		@returns @c true if the remainder of the current line needs to be generated; @c false if
+			it is unchanged since it was last generated. Once this has returned @c true it will
+			continue to do so until the next call to @c begin_line.
+	*/
+	bool needs_generation() {
+		is_generating_ |= !valid_[line_];
+		return is_generating_;
+	}
+
+	/*!
+		Copies the current line to @c crt as @c SamplesPerLine samples of type @c TargetT
+		spread over @c number_of_cycles.
+	*/
+	template <typename TargetT = SampleT>
+	void output(CRT &crt, const int number_of_cycles) {
+		static_assert(sizeof(TargetT) <= sizeof(SampleT));
+
+		const auto target = crt.begin_data(SamplesPerLine);
+		if(target) {
+			std::memcpy(target, &samples_[line_ * SamplesPerLine], SamplesPerLine * sizeof(TargetT));
+		}
+		crt.output_data(number_of_cycles, SamplesPerLine);
+	}
+
+private:
+	alignas(8) std::array<SampleT, SamplesPerLine * Lines> samples_;
+	std::array<uint32_t, Lines> contexts_{};
+	std::array<bool, Lines> valid_{};
+
+	size_t line_ = 0;
+	bool is_generating_ = true;
+};
+
+}
@@ -14,6 +14,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 
 namespace Outputs::Display {
 
@@ -652,6 +653,75 @@ struct NullScanTarget: public ScanTarget {
 	static NullScanTarget singleton;
 };
 
+/*!
+	Forwards everything to another scan target while enabled; otherwise discards all scans and data,
+	other than the completion of any that began while enabled.
+*/
+struct GatedScanTarget: public ScanTarget {
+	void set_target(ScanTarget *const target) {
+		target_ = target;
+		scan_target_ = data_target_ = nullptr;
+		if(target_) {
+			if(modals_) target_->set_modals(*modals_);
+			if(delegate_) target_->set_delegate(*delegate_);
+		}
+	}
+
+	void set_is_enabled(const bool is_enabled) {
+		is_enabled_ = is_enabled;
+	}
+
+	void set_modals(const Modals modals) override {
+		modals_ = modals;
+		if(target_) target_->set_modals(modals);
+	}
+
+	Scan *begin_scan() override {
+		scan_target_ = is_enabled_ ? target_ : nullptr;
+		return scan_target_ ? scan_target_->begin_scan() : nullptr;
+	}
+	void end_scan() override {
+		if(scan_target_) scan_target_->end_scan();
+	}
+
+	uint8_t *begin_data(const size_t required_length, const size_t required_alignment) override {
+		data_target_ = is_enabled_ ? target_ : nullptr;
+		return data_target_ ? data_target_->begin_data(required_length, required_alignment) : nullptr;
+	}
+	void end_data(const size_t actual_length) override {
+		if(data_target_) data_target_->end_data(actual_length);
+	}
+
+	void will_change_owner() override {
+		if(target_) target_->will_change_owner();
+	}
+	void submit() override {
+		if(is_enabled_ && target_) target_->submit();
+	}
+	void announce(
+		const Event event,
+		const bool is_visible,
+		const Scan::EndPoint &location,
+		const uint8_t composite_amplitude
+	) override {
+		if(is_enabled_ && target_) target_->announce(event, is_visible, location, composite_amplitude);
+	}
+
+	void set_delegate(Delegate &delegate) override {
+		delegate_ = &delegate;
+		if(target_) target_->set_delegate(delegate);
+	}
+
+private:
+	ScanTarget *target_ = nullptr;
+	ScanTarget *scan_target_ = nullptr;
+	ScanTarget *data_target_ = nullptr;
+	bool is_enabled_ = true;
+
+	std::optional<Modals> modals_;
+	Delegate *delegate_ = nullptr;
+};
+
 std::array<float, 9> aspect_ratio_transformation(const ScanTarget::Modals &, const float view_aspect_ratio);
 
 }
@@ -84,6 +84,15 @@ class BufferSource {
 		*/
 //		void set_sample_volume_range(std::int16_t volume);
 
+		/*!
+			Optionally, a sample source may be informed of the passage of time independently of
+			whether any samples are requested: @c will_run_for is called on the emulation thread as
+			a period of @c cycles is scheduled, and @c did_run_for is called on the audio thread
+			once the speaker has completed that period. See RegisterWriteLog.
+		*/
+//		void will_run_for(Cycles cycles);
+//		void did_run_for(Cycles cycles);
+
 		/*!
 			Permits a sample source to declare that, averaged over time, it will use only
 			a certain proportion of the allocated volume range. This commonly happens
@@ -106,11 +115,7 @@ public:
 		auto &source = *static_cast<SourceT *>(this);
 
 		if constexpr (divider == 1) {
-			while(number_of_samples--) {
-				apply<action>(*target, source.level());
-				++target;
-				source.advance();
-			}
+			apply_steps<action>(source, static_cast<int>(number_of_samples), target);
 		} else {
 			std::size_t c = 0;
 
@@ -124,12 +129,9 @@ public:
 			source.advance();
 
 			// Provide all full levels.
-			auto whole_steps = static_cast<int>((number_of_samples - c) / divider);
-			while(whole_steps--) {
-				fill<action>(&target[c], &target[c + divider], source.level());
-				c += divider;
-				source.advance();
-			}
+			const auto whole_steps = static_cast<int>((number_of_samples - c) / divider);
+			apply_steps<action>(source, whole_steps, &target[c]);
+			c += static_cast<std::size_t>(whole_steps * divider);
 
 			// Provide the head of a further partial capture.
 			level = source.level();
@@ -143,9 +145,39 @@ public:
 	// Until then: sample sources should implement this.
 //	typename SampleT<stereo>::type level() const;
 //	void advance();
+	//
+	// ... and may also implement the following, to allow periods of unchanging output to be
+	// produced in bulk:
+//	int stable_steps() const;	// The number of calls to advance() that won't change level().
+//	void advance(int steps);	// Equivalent to calling advance() `steps` times.
 
 private:
 	int master_divider_{};
+
+	/// Outputs @c steps complete steps of @c divider samples each, advancing after each.
+	template <Action action>
+	void apply_steps(SourceT &source, int steps, typename SampleT<stereo>::type *target) {
+		if constexpr (requires { source.stable_steps(); }) {
+			if constexpr (action == Action::Ignore) {
+				if(steps) source.advance(steps);
+				return;
+			}
+
+			while(steps) {
+				const int run = std::min(steps - 1, source.stable_steps()) + 1;
+				fill<action>(target, target + run * divider, source.level());
+				target += run * divider;
+				steps -= run;
+				source.advance(run);
+			}
+		} else {
+			while(steps--) {
+				fill<action>(target, target + divider, source.level());
+				target += divider;
+				source.advance();
+			}
+		}
+	}
 };
 
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "BufferSource.hpp"
+#include "ClockReceiver/ClockReceiver.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -52,6 +53,8 @@ private:
 		public:
 			static constexpr bool is_stereo = false;
 			void set_scaled_volume_range(int16_t, double *, double) {}
+			void will_run_for(Cycles) {}
+			void did_run_for(Cycles) {}
 			static constexpr std::size_t size() {	return 0;	}
 			double total_scale(double *) const {	return 0.0;	}
 	};
@@ -108,6 +111,20 @@ private:
 			next_source_.set_scaled_volume_range(range, &volumes[1], scale);
 		}
 
+		void will_run_for(const Cycles cycles) {
+			if constexpr (requires { source_.will_run_for(cycles); }) {
+				source_.will_run_for(cycles);
+			}
+			next_source_.will_run_for(cycles);
+		}
+
+		void did_run_for(const Cycles cycles) {
+			if constexpr (requires { source_.did_run_for(cycles); }) {
+				source_.did_run_for(cycles);
+			}
+			next_source_.did_run_for(cycles);
+		}
+
 		static constexpr std::size_t size() {
 			return 1 + CompoundSourceHolder<R...>::size();
 		}
@@ -141,6 +158,16 @@ public:
 		source_holder_.template apply_samples<action, ::Outputs::Speaker::is_stereo<T...>()>(number_of_samples, target);
 	}
 
+	/// Forwards to any constituent sources that observe the passage of time; see BufferSource.
+	void will_run_for(const Cycles cycles) {
+		source_holder_.will_run_for(cycles);
+	}
+
+	/// Forwards to any constituent sources that observe the passage of time; see BufferSource.
+	void did_run_for(const Cycles cycles) {
+		source_holder_.did_run_for(cycles);
+	}
+
 	/*!
 		Sets the total output volume of this CompoundSource.
 	*/
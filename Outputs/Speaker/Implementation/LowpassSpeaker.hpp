@@ -12,6 +12,7 @@
 #include "Outputs/Speaker/Speaker.hpp"
 #include "SignalProcessing/FIRFilter.hpp"
 #include "ClockReceiver/ClockReceiver.hpp"
+#include "ClockReceiver/Profiler.hpp"
 #include "Concurrency/AsyncTaskQueue.hpp"
 
 #include <algorithm>
@@ -374,8 +375,15 @@ public:
 			return;
 		}
 
+		if constexpr (requires { sample_source_.will_run_for(cycles); }) {
+			sample_source_.will_run_for(cycles);
+		}
 		queue.enqueue([this, cycles] {
+			const Profiler::Scope scope(Profiler::Component::Audio, cycles.get());
 			run_for(cycles);
+			if constexpr (requires { sample_source_.did_run_for(cycles); }) {
+				sample_source_.did_run_for(cycles);
+			}
 		});
 	}
 
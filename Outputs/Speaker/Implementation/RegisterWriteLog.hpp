@@ -0,0 +1,144 @@
+//
+//  RegisterWriteLog.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "ClockReceiver/ClockReceiver.hpp"
+#include "Concurrency/AsyncTaskQueue.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace Outputs::Speaker {
+
+/*!
+	Pipes timestamped writes from the emulation thread to a sample source on the audio thread
+	via a lock-free circular buffer, rather than enqueuing a closure per write.
+
+	Time is measured in the sample source's input samples. A sample source that owns a log should
+	implement the optional @c will_run_for and @c did_run_for members described by @c BufferSource
+	and forward them here, and should implement @c apply_samples in terms of @c generate.
+
+	Writes are applied to @c TargetT by calls to @c TargetT::apply(const WriteT &), on the audio thread,
+	at the input sample that corresponds to the time at which they were pushed.
+*/
+template <typename TargetT, typename WriteT, size_t Size = 8192>
+class RegisterWriteLog {
+public:
+	static_assert(!(Size & (Size - 1)), "Size must be a power of two");
+
+	RegisterWriteLog(TargetT &target, Concurrency::AsyncTaskQueue<false> &audio_queue) :
+		target_(target), audio_queue_(audio_queue) {}
+
+	// MARK: - Emulation thread.
+
+	/// Records @c write as occurring at the current time.
+	void push(const WriteT &write) {
+		const auto index = write_index_.load(std::memory_order_relaxed);
+		if(index - read_index_.load(std::memory_order_acquire) == Size) {
+			// The audio thread has fallen a whole buffer behind. Everything already logged is due,
+			// so have it applied no later than the end of the work currently queued — which matters
+			// if audio isn't currently being generated — then wait for half the buffer to become
+			// available, to avoid repeating this on every subsequent write.
+			audio_queue_.enqueue([this] {
+				apply_until(synchronised_time_);
+			});
+			audio_queue_.perform();
+			while(index - read_index_.load(std::memory_order_acquire) > Size / 2) {
+				std::this_thread::yield();
+			}
+		}
+
+		writes_[index & (Size - 1)] = Write{producer_time_, write};
+		write_index_.store(index + 1, std::memory_order_release);
+	}
+
+	/// Advances the time against which future writes will be recorded; to be called whenever
+	/// time is scheduled to pass on the audio thread.
+	void will_run_for(const Cycles cycles) {
+		producer_time_ += cycles.as<uint32_t>();
+	}
+
+	// MARK: - Audio thread.
+
+	/*!
+		Produces @c number_of_samples samples by calls to @c generator(length, target), applying any
+		writes that fall within that period at the appropriate moments.
+	*/
+	template <typename SampleT, typename GeneratorT>
+	void generate(size_t number_of_samples, SampleT *target, const GeneratorT &generator) {
+		while(number_of_samples) {
+			apply_until(consumer_time_);
+
+			// Generate either all remaining samples or as many as are before the next write.
+			size_t length = number_of_samples;
+			const auto index = read_index_.load(std::memory_order_relaxed);
+			if(index != write_index_.load(std::memory_order_acquire)) {
+				length = std::min(length, size_t(writes_[index & (Size - 1)].time - consumer_time_));
+			}
+
+			generator(length, target);
+			if(target) target += length;
+			consumer_time_ += uint32_t(length);
+			number_of_samples -= length;
+		}
+	}
+
+	/*!
+		Marks the end of a period of @c cycles that was scheduled via @c will_run_for. This ensures that
+		writes continue to be applied on time even if a speaker has declined to request audio, e.g. because
+		it has no delegate or because this source is currently silent.
+	*/
+	void did_run_for(const Cycles cycles) {
+		synchronised_time_ += cycles.as<uint32_t>();
+		if(is_before(consumer_time_, synchronised_time_)) {
+			consumer_time_ = synchronised_time_;
+		}
+		apply_until(consumer_time_);
+	}
+
+private:
+	TargetT &target_;
+	Concurrency::AsyncTaskQueue<false> &audio_queue_;
+
+	struct Write {
+		uint32_t time;
+		WriteT write;
+	};
+	std::array<Write, Size> writes_;
+
+	// Emulation-thread state; kept on a separate cache line from the audio thread's.
+	alignas(64) std::atomic<size_t> write_index_ = 0;
+	uint32_t producer_time_ = 0;
+
+	// Audio-thread state.
+	alignas(64) std::atomic<size_t> read_index_ = 0;
+	uint32_t consumer_time_ = 0;
+	uint32_t synchronised_time_ = 0;
+
+	/// @returns @c true if @c lhs is strictly before @c rhs, allowing for wraparound.
+	static bool is_before(const uint32_t lhs, const uint32_t rhs) {
+		return int32_t(lhs - rhs) < 0;
+	}
+
+	/// Applies all writes up to and including those at @c time.
+	void apply_until(const uint32_t time) {
+		auto index = read_index_.load(std::memory_order_relaxed);
+		const auto end = write_index_.load(std::memory_order_acquire);
+		while(index != end && !is_before(time, writes_[index & (Size - 1)].time)) {
+			target_.apply(writes_[index & (Size - 1)].write);
+			++index;
+			read_index_.store(index, std::memory_order_release);
+		}
+	}
+};
+
+}
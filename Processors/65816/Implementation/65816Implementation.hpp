@@ -76,9 +76,7 @@ template <typename BusHandler, bool uses_ready_line> void Processor<BusHandler,
 
 				case OperationDecode: {
 					active_instruction_ = &instructions[instruction_buffer_.value];
-
-					const auto size_flag = registers_.mx_flags[active_instruction_->size_field];
-					next_op_ = &micro_ops_[active_instruction_->program_offsets[size_flag]];
+					next_op_ = &micro_ops_[programs_[active_programs_][instruction_buffer_.value]];
 					instruction_buffer_.clear();
 				} continue;
 
@@ -533,6 +531,7 @@ template <typename BusHandler, bool uses_ready_line> void Processor<BusHandler,
 					if(pending_exceptions_ & Abort) {
 						// Special case: restore registers from start of instruction.
 						registers_ = abort_registers_copy_;
+						select_programs();
 
 						pending_exceptions_ &= ~Abort;
 						data_address_ = registers_.emulation_flag ? 0xfff8 : 0xffe8;
@@ -1104,6 +1104,15 @@ ProcessorStorage::ProcessorStorage() {
 	constructor.set_exception_generator(&ProcessorStorageConstructor::stack_exception, &ProcessorStorageConstructor::reset);
 	constructor.install_fetch_decode_execute();
 
+	// Bake in the program selection for every combination of M and X.
+	for(int mx = 0; mx < 4; mx++) {
+		const uint8_t mx_flags[2] = {uint8_t(mx & 1), uint8_t(mx >> 1)};
+		for(int opcode = 0; opcode < 256; opcode++) {
+			const auto &instruction = instructions[opcode];
+			programs_[mx][opcode] = instruction.program_offsets[mx_flags[instruction.size_field]];
+		}
+	}
+
 	// Find any OperationMoveToNextProgram.
 	next_op_ = micro_ops_.data();
 	while(*next_op_ != OperationMoveToNextProgram) ++next_op_;
@@ -1151,6 +1160,7 @@ void ProcessorStorage::set_m_x_flags(bool m, bool x) {
 	// true/1 => 8bit for both flags.
 	registers_.mx_flags[0] = m;
 	registers_.mx_flags[1] = x;
+	select_programs();
 }
 
 uint8_t ProcessorStorage::get_flags() const {
@@ -266,6 +266,17 @@ struct ProcessorStorage {
 										//	a duplicate entry for the final part of exceptions if the selected exception is a reset; and
 										//	the entry for fetch-decode-execute.
 
+	/// The program offsets for each opcode under each combination of the M and X flags, i.e.
+	/// @c programs_[m + 2*x][opcode] is @c instructions[opcode].program_offsets[mx_flags[size_field]]
+	/// for those flags. This allows decoding to skip any flag-dependent selection.
+	uint16_t programs_[4][256];
+
+	/// The index into @c programs_ that corresponds to the current M and X flags.
+	uint8_t active_programs_ = 3;
+	void select_programs() {
+		active_programs_ = uint8_t(registers_.mx_flags[0] + (registers_.mx_flags[1] << 1));
+	}
+
 	enum class OperationSlot {
 		Exception = 256,
 		Reset,
@@ -13,7 +13,7 @@ template <	class T,
 			bool uses_wait_line> Processor <T, uses_bus_request, uses_wait_line>
 				::Processor(T &bus_handler) :
 					bus_handler_(bus_handler) {
-	install_default_instruction_set();
+	install_default_instruction_set(uses_wait_line);
 }
 
 template <	class T,
@@ -29,16 +29,16 @@ template <	class T,
 			halt_mask_ = 0xff;
 			if(last_request_status_ & (Interrupt::PowerOn | Interrupt::Reset)) {
 				request_status_ &= ~Interrupt::PowerOn;
-				scheduled_program_counter_ = reset_program_.data();
+				scheduled_program_counter_ = programs_->reset_program.data();
 			} else if(last_request_status_ & Interrupt::NMI) {
 				request_status_ &= ~Interrupt::NMI;
-				scheduled_program_counter_ = nmi_program_.data();
+				scheduled_program_counter_ = programs_->nmi_program.data();
 			} else if(last_request_status_ & Interrupt::IRQ) {
-				scheduled_program_counter_ = irq_program_[interrupt_mode_].data();
+				scheduled_program_counter_ = programs_->irq_program[interrupt_mode_].data();
 			}
 		} else {
-			current_instruction_page_ = &base_page_;
-			scheduled_program_counter_ = base_page_.fetch_decode_execute_data;
+			current_instruction_page_ = &programs_->base_page;
+			scheduled_program_counter_ = programs_->base_page.fetch_decode_execute_data;
 		}
 	};
 
@@ -245,27 +245,27 @@ template <	class T,
 			scheduled_program_counter_++;
 
 			switch(operation->type) {
-				case MicroOp::BusOperation:
-					if(number_of_cycles_ < operation->machine_cycle.length) {
+				case MicroOp::BusOperation: {
+					const PartialMachineCycle &cycle = *relocate(static_cast<const PartialMachineCycle *>(operation->source));
+					if(number_of_cycles_ < cycle.length) {
 						scheduled_program_counter_--;
 						return;
 					}
-					if(uses_wait_line && operation->machine_cycle.was_requested) {
+					if(uses_wait_line && cycle.was_requested) {
 						if(wait_line_) {
 							scheduled_program_counter_--;
 						} else {
 							continue;
 						}
 					}
-					number_of_cycles_ -= operation->machine_cycle.length;
 					last_request_status_ = request_status_;
 
-					// TODO: eliminate this conditional if all bus cycles have an address filled in.
-					last_address_bus_ = operation->machine_cycle.address ? *operation->machine_cycle.address : 0xdead;
+					// All bus cycles in the instruction tables have an address filled in.
+					last_address_bus_ = *cycle.address;
 
-					number_of_cycles_ -= bus_handler_.perform_machine_cycle(operation->machine_cycle);
+					number_of_cycles_ -= cycle.length + bus_handler_.perform_machine_cycle(cycle);
 					if(uses_bus_request && bus_request_line_) goto do_bus_acknowledge;
-				break;
+				} break;
 				case MicroOp::MoveToNextProgram:
 					advance_operation();
 				break;
@@ -279,12 +279,12 @@ template <	class T,
 					flag_adjustment_history_ <<= 1;
 				break;
 
-				case MicroOp::Increment8NoFlags:	++ *static_cast<uint8_t *>(operation->source);			break;
-				case MicroOp::Increment16:			++ *static_cast<uint16_t *>(operation->source);			break;
+				case MicroOp::Increment8NoFlags:	++ *relocate(static_cast<uint8_t *>(operation->source));			break;
+				case MicroOp::Increment16:			++ *relocate(static_cast<uint16_t *>(operation->source));			break;
 				case MicroOp::IncrementPC:			pc_.full += pc_increment_;								break;
-				case MicroOp::Decrement16:			-- *static_cast<uint16_t *>(operation->source);			break;
-				case MicroOp::Move8:				*static_cast<uint8_t *>(operation->destination) = *static_cast<uint8_t *>(operation->source);		break;
-				case MicroOp::Move16:				*static_cast<uint16_t *>(operation->destination) = *static_cast<uint16_t *>(operation->source);		break;
+				case MicroOp::Decrement16:			-- *relocate(static_cast<uint16_t *>(operation->source));			break;
+				case MicroOp::Move8:				*relocate(static_cast<uint8_t *>(operation->destination)) = *relocate(static_cast<uint8_t *>(operation->source));		break;
+				case MicroOp::Move16:				*relocate(static_cast<uint16_t *>(operation->destination)) = *relocate(static_cast<uint16_t *>(operation->source));		break;
 
 				case MicroOp::AssembleAF:
 					temp16_.halves.high = a_;
@@ -298,17 +298,17 @@ template <	class T,
 // MARK: - Logical
 
 				case MicroOp::And:
-					a_ &= *static_cast<uint8_t *>(operation->source);
+					a_ &= *relocate(static_cast<uint8_t *>(operation->source));
 					set_logical_flags(Flag::HalfCarry);
 				break;
 
 				case MicroOp::Or:
-					a_ |= *static_cast<uint8_t *>(operation->source);
+					a_ |= *relocate(static_cast<uint8_t *>(operation->source));
 					set_logical_flags(0);
 				break;
 
 				case MicroOp::Xor:
-					a_ ^= *static_cast<uint8_t *>(operation->source);
+					a_ ^= *relocate(static_cast<uint8_t *>(operation->source));
 					set_logical_flags(0);
 				break;
 
@@ -360,7 +360,7 @@ template <	class T,
 // MARK: - 8-bit arithmetic
 
 				case MicroOp::CP8: {
-					const uint8_t value = *static_cast<uint8_t *>(operation->source);
+					const uint8_t value = *relocate(static_cast<uint8_t *>(operation->source));
 					const int result = a_ - value;
 					const int half_result = (a_&0xf) - (value&0xf);
 
@@ -373,7 +373,7 @@ template <	class T,
 				} break;
 
 				case MicroOp::SUB8: {
-					const uint8_t value = *static_cast<uint8_t *>(operation->source);
+					const uint8_t value = *relocate(static_cast<uint8_t *>(operation->source));
 					const int result = a_ - value;
 					const int half_result = (a_&0xf) - (value&0xf);
 
@@ -386,7 +386,7 @@ template <	class T,
 				} break;
 
 				case MicroOp::SBC8: {
-					const uint8_t value = *static_cast<uint8_t *>(operation->source);
+					const uint8_t value = *relocate(static_cast<uint8_t *>(operation->source));
 					const int result = a_ - value - (carry_result_ & Flag::Carry);
 					const int half_result = (a_&0xf) - (value&0xf) - (carry_result_ & Flag::Carry);
 
@@ -399,7 +399,7 @@ template <	class T,
 				} break;
 
 				case MicroOp::ADD8: {
-					const uint8_t value = *static_cast<uint8_t *>(operation->source);
+					const uint8_t value = *relocate(static_cast<uint8_t *>(operation->source));
 					const int result = a_ + value;
 					const int half_result = (a_&0xf) + (value&0xf);
 
@@ -412,7 +412,7 @@ template <	class T,
 				} break;
 
 				case MicroOp::ADC8: {
-					const uint8_t value = *static_cast<uint8_t *>(operation->source);
+					const uint8_t value = *relocate(static_cast<uint8_t *>(operation->source));
 					const int result = a_ + value + (carry_result_ & Flag::Carry);
 					const int half_result = (a_&0xf) + (value&0xf) + (carry_result_ & Flag::Carry);
 
@@ -434,7 +434,7 @@ template <	class T,
 				} break;
 
 				case MicroOp::Increment8: {
-					const uint8_t value = *static_cast<uint8_t *>(operation->source);
+					const uint8_t value = *relocate(static_cast<uint8_t *>(operation->source));
 					const int result = value + 1;
 
 					// with an increment, overflow occurs if the sign changes from
@@ -442,7 +442,7 @@ template <	class T,
 					const int overflow = (value ^ result) & ~value;
 					const int half_result = (value&0xf) + 1;
 
-					*static_cast<uint8_t *>(operation->source) = uint8_t(result);
+					*relocate(static_cast<uint8_t *>(operation->source)) = uint8_t(result);
 
 					// sign, zero and 5 & 3 are set directly from the result
 					bit53_result_ = sign_result_ = zero_result_ = uint8_t(result);
@@ -453,7 +453,7 @@ template <	class T,
 				} break;
 
 				case MicroOp::Decrement8: {
-					const uint8_t value = *static_cast<uint8_t *>(operation->source);
+					const uint8_t value = *relocate(static_cast<uint8_t *>(operation->source));
 					const int result = value - 1;
 
 					// with a decrement, overflow occurs if the sign changes from
@@ -461,7 +461,7 @@ template <	class T,
 					const int overflow = (value ^ result) & value;
 					const int half_result = (value&0xf) - 1;
 
-					*static_cast<uint8_t *>(operation->source) = uint8_t(result);
+					*relocate(static_cast<uint8_t *>(operation->source)) = uint8_t(result);
 
 					// sign, zero and 5 & 3 are set directly from the result
 					bit53_result_ = sign_result_ = zero_result_ = uint8_t(result);
@@ -517,8 +517,8 @@ template <	class T,
 // MARK: - 16-bit arithmetic
 
 				case MicroOp::ADD16: {
-					memptr_.full = *static_cast<uint16_t *>(operation->destination);
-					const uint16_t sourceValue = *static_cast<uint16_t *>(operation->source);
+					memptr_.full = *relocate(static_cast<uint16_t *>(operation->destination));
+					const uint16_t sourceValue = *relocate(static_cast<uint16_t *>(operation->source));
 					const uint16_t destinationValue = memptr_.full;
 					const int result = sourceValue + destinationValue;
 					const int half_result = (sourceValue&0xfff) + (destinationValue&0xfff);
@@ -529,13 +529,13 @@ template <	class T,
 					subtract_flag_ = 0;
 					set_did_compute_flags();
 
-					*static_cast<uint16_t *>(operation->destination) = uint16_t(result);
+					*relocate(static_cast<uint16_t *>(operation->destination)) = uint16_t(result);
 					memptr_.full++;
 				} break;
 
 				case MicroOp::ADC16: {
-					memptr_.full = *static_cast<uint16_t *>(operation->destination);
-					const uint16_t sourceValue = *static_cast<uint16_t *>(operation->source);
+					memptr_.full = *relocate(static_cast<uint16_t *>(operation->destination));
+					const uint16_t sourceValue = *relocate(static_cast<uint16_t *>(operation->source));
 					const uint16_t destinationValue = memptr_.full;
 					const int result = sourceValue + destinationValue + (carry_result_ & Flag::Carry);
 					const int half_result = (sourceValue&0xfff) + (destinationValue&0xfff) + (carry_result_ & Flag::Carry);
@@ -551,13 +551,13 @@ template <	class T,
 					parity_overflow_result_ = uint8_t(overflow >> 13);
 					set_did_compute_flags();
 
-					*static_cast<uint16_t *>(operation->destination) = uint16_t(result);
+					*relocate(static_cast<uint16_t *>(operation->destination)) = uint16_t(result);
 					memptr_.full++;
 				} break;
 
 				case MicroOp::SBC16: {
-					memptr_.full = *static_cast<uint16_t *>(operation->destination);
-					const uint16_t sourceValue = *static_cast<uint16_t *>(operation->source);
+					memptr_.full = *relocate(static_cast<uint16_t *>(operation->destination));
+					const uint16_t sourceValue = *relocate(static_cast<uint16_t *>(operation->source));
 					const uint16_t destinationValue = memptr_.full;
 					const int result = destinationValue - sourceValue - (carry_result_ & Flag::Carry);
 					const int half_result = (destinationValue&0xfff) - (sourceValue&0xfff) - (carry_result_ & Flag::Carry);
@@ -576,7 +576,7 @@ template <	class T,
 					parity_overflow_result_ = uint8_t(overflow >> 13);
 					set_did_compute_flags();
 
-					*static_cast<uint16_t *>(operation->destination) = uint16_t(result);
+					*relocate(static_cast<uint16_t *>(operation->destination)) = uint16_t(result);
 					memptr_.full++;
 				} break;
 
@@ -660,13 +660,13 @@ template <	class T,
 // MARK: - Bit Manipulation
 
 				case MicroOp::BIT: {
-					const uint8_t result = *static_cast<uint8_t *>(operation->source) & (1 << ((operation_ >> 3)&7));
+					const uint8_t result = *relocate(static_cast<uint8_t *>(operation->source)) & (1 << ((operation_ >> 3)&7));
 
 					// Leak MEMPTR into bits 5 and 3 if this is either BIT n,(HL) or BIT n,(IX/IY+d).
 					if(current_instruction_page_->is_indexed || ((operation_&0x07) == 6)) {
 						bit53_result_ = memptr_.halves.high;
 					} else {
-						bit53_result_ = *static_cast<uint8_t *>(operation->source);
+						bit53_result_ = *relocate(static_cast<uint8_t *>(operation->source));
 					}
 
 					sign_result_ = zero_result_ = result;
@@ -677,11 +677,11 @@ template <	class T,
 				} break;
 
 				case MicroOp::RES:
-					*static_cast<uint8_t *>(operation->source) &= ~(1 << ((operation_ >> 3)&7));
+					*relocate(static_cast<uint8_t *>(operation->source)) &= ~(1 << ((operation_ >> 3)&7));
 				break;
 
 				case MicroOp::SET:
-					*static_cast<uint8_t *>(operation->source) |= (1 << ((operation_ >> 3)&7));
+					*relocate(static_cast<uint8_t *>(operation->source)) |= (1 << ((operation_ >> 3)&7));
 				break;
 
 // MARK: - Rotation and shifting
@@ -709,21 +709,21 @@ template <	class T,
 				break;
 
 				case MicroOp::RLC: {
-					uint8_t &source = *static_cast<uint8_t *>(operation->source);
+					uint8_t &source = *relocate(static_cast<uint8_t *>(operation->source));
 					source = std::rotl(source, 1);
 					carry_result_ = source;
 					set_shift_flags(source);
 				} break;
 
 				case MicroOp::RRC: {
-					uint8_t &source = *static_cast<uint8_t *>(operation->source);
+					uint8_t &source = *relocate(static_cast<uint8_t *>(operation->source));
 					carry_result_ = source;
 					source = std::rotr(source, 1);
 					set_shift_flags(source);
 				} break;
 
 				case MicroOp::RL: {
-					uint8_t &source = *static_cast<uint8_t *>(operation->source);
+					uint8_t &source = *relocate(static_cast<uint8_t *>(operation->source));
 					const uint8_t next_carry = source >> 7;
 					source = uint8_t((source << 1) | (carry_result_ & Flag::Carry));
 					carry_result_ = next_carry;
@@ -731,7 +731,7 @@ template <	class T,
 				} break;
 
 				case MicroOp::RR: {
-					uint8_t &source = *static_cast<uint8_t *>(operation->source);
+					uint8_t &source = *relocate(static_cast<uint8_t *>(operation->source));
 					const uint8_t next_carry = source;
 					source = uint8_t((source >> 1) | (carry_result_ << 7));
 					carry_result_ = next_carry;
@@ -739,28 +739,28 @@ template <	class T,
 				} break;
 
 				case MicroOp::SLA: {
-					uint8_t &source = *static_cast<uint8_t *>(operation->source);
+					uint8_t &source = *relocate(static_cast<uint8_t *>(operation->source));
 					carry_result_ = source >> 7;
 					source <<= 1;
 					set_shift_flags(source);
 				} break;
 
 				case MicroOp::SRA: {
-					uint8_t &source = *static_cast<uint8_t *>(operation->source);
+					uint8_t &source = *relocate(static_cast<uint8_t *>(operation->source));
 					carry_result_ = source;
 					source = uint8_t((source >> 1) | (source & 0x80));
 					set_shift_flags(source);
 				} break;
 
 				case MicroOp::SLL: {
-					uint8_t &source = *static_cast<uint8_t *>(operation->source);
+					uint8_t &source = *relocate(static_cast<uint8_t *>(operation->source));
 					carry_result_ = source >> 7;
 					source = uint8_t(source << 1) | 1;
 					set_shift_flags(source);
 				} break;
 
 				case MicroOp::SRL: {
-					uint8_t &source = *static_cast<uint8_t *>(operation->source);
+					uint8_t &source = *relocate(static_cast<uint8_t *>(operation->source));
 					carry_result_ = source;
 					source >>= 1;
 					set_shift_flags(source);
@@ -807,7 +807,7 @@ template <	class T,
 
 				case MicroOp::SetInFlags:
 					subtract_flag_ = half_carry_result_ = 0;
-					sign_result_ = zero_result_ = bit53_result_ = *static_cast<uint8_t *>(operation->source);
+					sign_result_ = zero_result_ = bit53_result_ = *relocate(static_cast<uint8_t *>(operation->source));
 					set_parity(sign_result_);
 					set_did_compute_flags();
 					++memptr_.full;
@@ -874,16 +874,16 @@ template <	class T,
 // MARK: - Internal bookkeeping
 
 				case MicroOp::SetInstructionPage:
-					current_instruction_page_ = static_cast<InstructionPage *>(operation->source);
+					current_instruction_page_ = static_cast<const InstructionPage *>(operation->source);
 					scheduled_program_counter_ = current_instruction_page_->fetch_decode_execute_data;
 				break;
 
 				case MicroOp::CalculateIndexAddress:
-					memptr_.full = uint16_t(*static_cast<uint16_t *>(operation->source) + int8_t(temp8_));
+					memptr_.full = uint16_t(*relocate(static_cast<uint16_t *>(operation->source)) + int8_t(temp8_));
 				break;
 
 				case MicroOp::SetAddrAMemptr:
-					memptr_.full = uint16_t(((*static_cast<uint16_t *>(operation->source) + 1)&0xff) + (a_ << 8));
+					memptr_.full = uint16_t(((*relocate(static_cast<uint16_t *>(operation->source)) + 1)&0xff) + (a_ << 8));
 				break;
 
 				case MicroOp::IndexedPlaceHolder:
@@ -924,87 +924,6 @@ template <	class T,
 	return wait_line_;
 }
 
-template <	class T,
-			bool uses_bus_request,
-			bool uses_wait_line> void Processor <T, uses_bus_request, uses_wait_line>
-				::assemble_page(InstructionPage &target, InstructionTable &table, bool add_offsets) {
-	std::size_t number_of_micro_ops = 0;
-	std::size_t lengths[256];
-
-	// Count number of micro-ops required.
-	for(int c = 0; c < 256; c++) {
-		std::size_t length = 0;
-		while(!is_terminal(table[c][length].type)) length++;
-		length++;
-		lengths[c] = length;
-		number_of_micro_ops += length;
-	}
-
-	// Allocate a landing area.
-	std::vector<std::size_t> operation_indices;
-	target.all_operations.reserve(number_of_micro_ops);
-	target.instructions.resize(256, nullptr);
-
-	// Copy in all programs, recording where they go.
-	for(std::size_t c = 0; c < 256; c++) {
-		operation_indices.push_back(target.all_operations.size());
-		for(std::size_t t = 0; t < lengths[c];) {
-			// Skip zero-length bus cycles.
-			if(table[c][t].type == MicroOp::BusOperation && table[c][t].machine_cycle.length.get() == 0) {
-				t++;
-				continue;
-			}
-
-			// Skip optional waits if this instance doesn't use the wait line.
-			if(table[c][t].machine_cycle.was_requested && !uses_wait_line) {
-				t++;
-				continue;
-			}
-
-			// If an index placeholder is hit then drop it, and if offsets aren't being added,
-			// then also drop the indexing that follows, which is assumed to be everything
-			// up to and including the next ::CalculateIndexAddress. Coupled to the INDEX() macro.
-			if(table[c][t].type == MicroOp::IndexedPlaceHolder) {
-				t++;
-				if(!add_offsets) {
-					while(table[c][t].type != MicroOp::CalculateIndexAddress) t++;
-					t++;
-				}
-			}
-			target.all_operations.emplace_back(table[c][t]);
-			t++;
-		}
-	}
-
-	// Since the vector won't change again, it's now safe to set pointers.
-	std::size_t c = 0;
-	for(std::size_t index : operation_indices) {
-		target.instructions[c] = &target.all_operations[index];
-		c++;
-	}
-}
-
-template <	class T,
-			bool uses_bus_request,
-			bool uses_wait_line> void Processor <T, uses_bus_request, uses_wait_line>
-		::copy_program(const MicroOp *source, std::vector<MicroOp> &destination) {
-	std::size_t length = 0;
-	while(!is_terminal(source[length].type)) length++;
-	std::size_t pointer = 0;
-	while(true) {
-		// TODO: This test is duplicated from assemble_page; can a better factoring be found?
-		// Skip optional waits if this instance doesn't use the wait line.
-		if(source[pointer].machine_cycle.was_requested && !uses_wait_line) {
-			pointer++;
-			continue;
-		}
-
-		destination.emplace_back(source[pointer]);
-		if(is_terminal(source[pointer].type)) break;
-		pointer++;
-	}
-}
-
 bool ProcessorBase::get_halt_line() const {
 	return halt_mask_ == 0x00;
 }
@@ -8,13 +8,70 @@
 
 #include "Processors/Z80/Z80.hpp"
 #include <algorithm>
+#include <stdexcept>
 
 using namespace CPU::Z80;
 
+namespace {
+
+/*!
+	Builds and owns the microprograms for a single wait-line configuration; all pointers
+	to processor state within those programs refer to this instance.
+*/
+struct Prototype: public ProcessorStorage {
+	Prototype(bool uses_wait_line);
+	Programs programs;
+
+private:
+	const bool uses_wait_line_;
+
+	/// A micro-op as it is described in the tables below, possibly with an attached bus cycle.
+	struct TableOp: public MicroOp {
+		PartialMachineCycle machine_cycle{};
+	};
+	typedef TableOp InstructionTable[256][30];
+
+	MicroOp micro_op(const TableOp &);
+	void assemble_page(InstructionPage &target, InstructionTable &table, bool add_offsets);
+	void copy_program(const TableOp *source, std::vector<MicroOp> &destination);
+
+	void assemble_fetch_decode_execute(InstructionPage &target, int length);
+	void assemble_ed_page(InstructionPage &target);
+	void assemble_cb_page(InstructionPage &target, CPU::RegisterPair16 &index, bool add_offsets);
+	void assemble_base_page(InstructionPage &target, CPU::RegisterPair16 &index, bool add_offsets, InstructionPage &cb_page);
+};
+
+const Prototype &prototype(const bool uses_wait_line) {
+	if(uses_wait_line) {
+		static const Prototype prototype(true);
+		return prototype;
+	}
+	static const Prototype prototype(false);
+	return prototype;
+}
+
+}
+
 ProcessorStorage::ProcessorStorage() {
 	set_flags(0xff);
 }
 
+void ProcessorStorage::install_default_instruction_set(const bool uses_wait_line) {
+	const auto &source = prototype(uses_wait_line);
+	programs_ = &source.programs;
+	relocation_ =
+		reinterpret_cast<uintptr_t>(this) -
+		reinterpret_cast<uintptr_t>(static_cast<const ProcessorStorage *>(&source));
+
+	const auto &source_cycles = static_cast<const ProcessorStorage &>(source).bus_cycles_;
+	for(size_t c = 0; c < programs_->bus_cycle_count; c++) {
+		auto &cycle = bus_cycles_[c];
+		cycle = source_cycles[c];
+		cycle.address = relocate(cycle.address);
+		if(cycle.value) cycle.value = relocate(cycle.value);
+	}
+}
+
 // Elemental bus operations
 #define ReadOpcodeStart()			PartialMachineCycle(PartialMachineCycle::ReadOpcodeStart, HalfCycles(3), &pc_.full, &operation_, false)
 #define ReadOpcodeWait(f)			PartialMachineCycle(PartialMachineCycle::ReadOpcodeWait, HalfCycles(2), &pc_.full, &operation_, f)
@@ -84,7 +141,7 @@ ProcessorStorage::ProcessorStorage() {
 #define NOP						{ {MicroOp::MoveToNextProgram} }
 
 #define JP(cc)					Sequence(Read16Inc(pc_, memptr_), {MicroOp::cc}, {MicroOp::Move16, &memptr_.full, &pc_.full})
-#define CALL(cc)				Sequence(ReadInc(pc_, memptr_.halves.low), {MicroOp::cc, conditional_call_untaken_program_.data()}, ReadInc(pc_, memptr_.halves.high), InternalOperation(2), Push(pc_), {MicroOp::Move16, &memptr_.full, &pc_.full})
+#define CALL(cc)				Sequence(ReadInc(pc_, memptr_.halves.low), {MicroOp::cc, programs.conditional_call_untaken_program.data()}, ReadInc(pc_, memptr_.halves.high), InternalOperation(2), Push(pc_), {MicroOp::Move16, &memptr_.full, &pc_.full})
 #define RET(cc)					Sequence(InternalOperation(2), {MicroOp::cc}, Pop(memptr_), {MicroOp::Move16, &memptr_.full, &pc_.full})
 #define JR(cc)					Sequence(ReadInc(pc_, temp8_), {MicroOp::cc}, InternalOperation(10), {MicroOp::CalculateIndexAddress, &pc_.full}, {MicroOp::Move16, &memptr_.full, &pc_.full})
 #define RST()					Sequence(InternalOperation(2), {MicroOp::CalculateRSTDestination}, Push(pc_), {MicroOp::Move16, &memptr_.full, &pc_.full})
@@ -144,35 +201,35 @@ ProcessorStorage::ProcessorStorage() {
 #define ADC16(d, s) Sequence(InternalOperation(8), InternalOperation(6), {MicroOp::ADC16, &s.full, &d.full})
 #define SBC16(d, s) Sequence(InternalOperation(8), InternalOperation(6), {MicroOp::SBC16, &s.full, &d.full})
 
-void ProcessorStorage::install_default_instruction_set() {
-	MicroOp conditional_call_untaken_program[] = Sequence(ReadInc(pc_, memptr_.halves.high));
-	copy_program(conditional_call_untaken_program, conditional_call_untaken_program_);
+Prototype::Prototype(const bool uses_wait_line) : uses_wait_line_(uses_wait_line) {
+	TableOp conditional_call_untaken_program[] = Sequence(ReadInc(pc_, memptr_.halves.high));
+	copy_program(conditional_call_untaken_program, programs.conditional_call_untaken_program);
 
-	assemble_base_page(base_page_, hl_, false, cb_page_);
-	assemble_base_page(dd_page_, ix_, true, ddcb_page_);
-	assemble_base_page(fd_page_, iy_, true, fdcb_page_);
-	assemble_ed_page(ed_page_);
+	assemble_base_page(programs.base_page, hl_, false, programs.cb_page);
+	assemble_base_page(programs.dd_page, ix_, true, programs.ddcb_page);
+	assemble_base_page(programs.fd_page, iy_, true, programs.fdcb_page);
+	assemble_ed_page(programs.ed_page);
 
-	fd_page_.is_indexed = true;
-	fdcb_page_.is_indexed = true;
-	dd_page_.is_indexed = true;
-	ddcb_page_.is_indexed = true;
+	programs.fd_page.is_indexed = true;
+	programs.fdcb_page.is_indexed = true;
+	programs.dd_page.is_indexed = true;
+	programs.ddcb_page.is_indexed = true;
 
-	assemble_fetch_decode_execute(base_page_, 4);
-	assemble_fetch_decode_execute(dd_page_, 4);
-	assemble_fetch_decode_execute(fd_page_, 4);
-	assemble_fetch_decode_execute(ed_page_, 4);
-	assemble_fetch_decode_execute(cb_page_, 4);
+	assemble_fetch_decode_execute(programs.base_page, 4);
+	assemble_fetch_decode_execute(programs.dd_page, 4);
+	assemble_fetch_decode_execute(programs.fd_page, 4);
+	assemble_fetch_decode_execute(programs.ed_page, 4);
+	assemble_fetch_decode_execute(programs.cb_page, 4);
 
-	assemble_fetch_decode_execute(fdcb_page_, 3);
-	assemble_fetch_decode_execute(ddcb_page_, 3);
+	assemble_fetch_decode_execute(programs.fdcb_page, 3);
+	assemble_fetch_decode_execute(programs.ddcb_page, 3);
 
-	MicroOp reset_program[] = Sequence(InternalOperation(6), {MicroOp::Reset});
+	TableOp reset_program[] = Sequence(InternalOperation(6), {MicroOp::Reset});
 
 	// Justification for NMI timing: per Wilf Rigter on the ZX81 (http://www.user.dccnet.com/wrigter/index_files/ZX81WAIT.htm),
 	// wait cycles occur between T2 and T3 during NMI; extending the refresh cycle is also consistent with my guess
 	// for the action of other non-four-cycle opcode fetches
-	MicroOp nmi_program[] = {
+	TableOp nmi_program[] = {
 		{ MicroOp::BeginNMI },
 		BusOp(ReadOpcodeStart()),
 		BusOp(ReadOpcodeWait(true)),
@@ -183,14 +240,14 @@ void ProcessorStorage::install_default_instruction_set() {
 		{ MicroOp::JumpTo66 },
 		{ MicroOp::MoveToNextProgram }
 	};
-	MicroOp irq_mode0_program[] = {
+	TableOp irq_mode0_program[] = {
 		{ MicroOp::BeginIRQMode0 },
 		BusOp(IntAckStart(5, operation_)),
 		BusOp(IntWait(operation_)),
 		BusOp(IntAckEnd(operation_)),
 		{ MicroOp::DecodeOperation }
 	};
-	MicroOp irq_mode1_program[] = {
+	TableOp irq_mode1_program[] = {
 		{ MicroOp::BeginIRQ },
 		BusOp(IntAckStart(7, operation_)),	// 7 half cycles (including  +
 		BusOp(IntWait(operation_)),			// [potentially 2 half cycles] +
@@ -200,7 +257,7 @@ void ProcessorStorage::install_default_instruction_set() {
 		{ MicroOp::Move16, &temp16_.full, &pc_.full },
 		{ MicroOp::MoveToNextProgram }
 	};
-	MicroOp irq_mode2_program[] = {
+	TableOp irq_mode2_program[] = {
 		{ MicroOp::BeginIRQ },
 		BusOp(IntAckStart(7, temp16_.halves.low)),
 		BusOp(IntWait(temp16_.halves.low)),
@@ -212,14 +269,14 @@ void ProcessorStorage::install_default_instruction_set() {
 		{ MicroOp::MoveToNextProgram }
 	};
 
-	copy_program(reset_program, reset_program_);
-	copy_program(nmi_program, nmi_program_);
-	copy_program(irq_mode0_program, irq_program_[0]);
-	copy_program(irq_mode1_program, irq_program_[1]);
-	copy_program(irq_mode2_program, irq_program_[2]);
+	copy_program(reset_program, programs.reset_program);
+	copy_program(nmi_program, programs.nmi_program);
+	copy_program(irq_mode0_program, programs.irq_program[0]);
+	copy_program(irq_mode1_program, programs.irq_program[1]);
+	copy_program(irq_mode2_program, programs.irq_program[2]);
 }
 
-void ProcessorStorage::assemble_ed_page(InstructionPage &target) {
+void Prototype::assemble_ed_page(InstructionPage &target) {
 #define IN_C(r)		Sequence({MicroOp::Move16, &bc_.full, &memptr_.full}, Input(bc_, r), {MicroOp::SetInFlags, &r})
 #define OUT_C(r)	Sequence(Output(bc_, r), {MicroOp::SetOutFlags})
 #define IN_OUT(r)	IN_C(r), OUT_C(r)
@@ -293,7 +350,7 @@ void ProcessorStorage::assemble_ed_page(InstructionPage &target) {
 #undef NOP_ROW
 }
 
-void ProcessorStorage::assemble_cb_page(InstructionPage &target, RegisterPair16 &index, bool add_offsets) {
+void Prototype::assemble_cb_page(InstructionPage &target, CPU::RegisterPair16 &index, bool add_offsets) {
 #define OCTO_OP_GROUP(m, x)	m(x),	m(x),	m(x),	m(x),	m(x),	m(x),	m(x),	m(x)
 #define CB_PAGE(m, p)	m(RLC), m(RRC),	m(RL),	m(RR),	m(SLA),	m(SRA),	m(SLL),	m(SRL),	OCTO_OP_GROUP(p, BIT),	OCTO_OP_GROUP(m, RES),	OCTO_OP_GROUP(m, SET)
 
@@ -320,7 +377,7 @@ void ProcessorStorage::assemble_cb_page(InstructionPage &target, RegisterPair16
 #undef CB_PAGE
 }
 
-void ProcessorStorage::assemble_base_page(InstructionPage &target, RegisterPair16 &index, bool add_offsets, InstructionPage &cb_page) {
+void Prototype::assemble_base_page(InstructionPage &target, CPU::RegisterPair16 &index, bool add_offsets, InstructionPage &cb_page) {
 #define INC_DEC_LD(r)	\
 				Sequence({MicroOp::Increment8, &r}),	\
 				Sequence({MicroOp::Decrement8, &r}),	\
@@ -465,7 +522,7 @@ void ProcessorStorage::assemble_base_page(InstructionPage &target, RegisterPair1
 		/* 0xd7 RST 10h */	RST(),
 		/* 0xd8 RET C */	RET(TestC),								/* 0xd9 EXX */		Sequence({MicroOp::EXX}),
 		/* 0xda JP C */		JP(TestC),								/* 0xdb IN A, (n) */Sequence(ReadInc(pc_, memptr_.halves.low), {MicroOp::Move8, &a_, &memptr_.halves.high}, Input(memptr_, a_), Inc16(memptr_)),
-		/* 0xdc CALL C */	CALL(TestC),							/* 0xdd [DD page] */Sequence({MicroOp::SetInstructionPage, &dd_page_}),
+		/* 0xdc CALL C */	CALL(TestC),							/* 0xdd [DD page] */Sequence({MicroOp::SetInstructionPage, &programs.dd_page}),
 		/* 0xde SBC A, n */	Sequence(ReadInc(pc_, temp8_), {MicroOp::SBC8, &temp8_}),
 		/* 0xdf RST 18h */	RST(),
 		/* 0xe0 RET PO */	RET(TestPO),							/* 0xe1 POP HL */	Sequence(Pop(index)),
@@ -475,7 +532,7 @@ void ProcessorStorage::assemble_base_page(InstructionPage &target, RegisterPair1
 		/* 0xe7 RST 20h */	RST(),
 		/* 0xe8 RET PE */	RET(TestPE),							/* 0xe9 JP (HL) */	Sequence({MicroOp::Move16, &index.full, &pc_.full}),
 		/* 0xea JP PE */	JP(TestPE),								/* 0xeb EX DE, HL */Sequence({MicroOp::ExDEHL}),
-		/* 0xec CALL PE */	CALL(TestPE),							/* 0xed [ED page] */Sequence({MicroOp::SetInstructionPage, &ed_page_}),
+		/* 0xec CALL PE */	CALL(TestPE),							/* 0xed [ED page] */Sequence({MicroOp::SetInstructionPage, &programs.ed_page}),
 		/* 0xee XOR n */	Sequence(ReadInc(pc_, temp8_), {MicroOp::Xor, &temp8_}),
 		/* 0xef RST 28h */	RST(),
 		/* 0xf0 RET p */	RET(TestP),								/* 0xf1 POP AF */	Sequence(Pop(temp16_), {MicroOp::DisassembleAF}),
@@ -485,7 +542,7 @@ void ProcessorStorage::assemble_base_page(InstructionPage &target, RegisterPair1
 		/* 0xf7 RST 30h */	RST(),
 		/* 0xf8 RET M */	RET(TestM),								/* 0xf9 LD SP, HL */Sequence(InternalOperation(4), {MicroOp::Move16, &index.full, &sp_.full}),
 		/* 0xfa JP M */		JP(TestM),								/* 0xfb EI */		Sequence({MicroOp::EI}),
-		/* 0xfc CALL M */	CALL(TestM),							/* 0xfd [FD page] */Sequence({MicroOp::SetInstructionPage, &fd_page_}),
+		/* 0xfc CALL M */	CALL(TestM),							/* 0xfd [FD page] */Sequence({MicroOp::SetInstructionPage, &programs.fd_page}),
 		/* 0xfe CP n */		Sequence(ReadInc(pc_, temp8_), {MicroOp::CP8, &temp8_}),
 		/* 0xff RST 38h */	RST(),
 	};
@@ -503,9 +560,9 @@ void ProcessorStorage::assemble_base_page(InstructionPage &target, RegisterPair1
 	assemble_page(target, base_program_table, add_offsets);
 }
 
-void ProcessorStorage::assemble_fetch_decode_execute(InstructionPage &target, int length) {
+void Prototype::assemble_fetch_decode_execute(InstructionPage &target, int length) {
 	/// The fetch-decode-execute sequence for a regular four-clock M1 cycle.
-	const MicroOp normal_fetch_decode_execute[] = {
+	const TableOp normal_fetch_decode_execute[] = {
 		BusOp(ReadOpcodeStart()),
 		BusOp(ReadOpcodeWait(true)),
 		BusOp(ReadOpcodeEnd()),
@@ -517,7 +574,7 @@ void ProcessorStorage::assemble_fetch_decode_execute(InstructionPage &target, in
 	/// The concluding fetch-decode-execute of a [dd/fd]cb nn oo sequence, i.e. an (IX+n) or (IY+n) operation.
 	/// Per the observed 48kb/128kb Spectrum timings, this appears not to include a refresh cycle. So I've also
 	/// taken a punt on it not incrementing R.
-	const MicroOp short_fetch_decode_execute[] = {
+	const TableOp short_fetch_decode_execute[] = {
 		BusOp(ReadStart(pc_, operation_)),
 		BusOp(ReadWait(pc_, operation_)),
 		BusOp(ReadEnd(pc_, operation_)),
@@ -529,10 +586,113 @@ void ProcessorStorage::assemble_fetch_decode_execute(InstructionPage &target, in
 	target.fetch_decode_execute_data = target.fetch_decode_execute.data();
 }
 
+void Prototype::assemble_page(InstructionPage &target, InstructionTable &table, bool add_offsets) {
+	std::size_t number_of_micro_ops = 0;
+	std::size_t lengths[256];
+
+	// Count number of micro-ops required.
+	for(int c = 0; c < 256; c++) {
+		std::size_t length = 0;
+		while(!is_terminal(table[c][length].type)) length++;
+		length++;
+		lengths[c] = length;
+		number_of_micro_ops += length;
+	}
+
+	// Allocate a landing area.
+	std::vector<std::size_t> operation_indices;
+	target.all_operations.reserve(number_of_micro_ops);
+	target.instructions.resize(256, nullptr);
+
+	// Copy in all programs, recording where they go.
+	for(std::size_t c = 0; c < 256; c++) {
+		operation_indices.push_back(target.all_operations.size());
+		for(std::size_t t = 0; t < lengths[c];) {
+			// Skip zero-length bus cycles.
+			if(table[c][t].type == MicroOp::BusOperation && table[c][t].machine_cycle.length.get() == 0) {
+				t++;
+				continue;
+			}
+
+			// Skip optional waits if this instance doesn't use the wait line.
+			if(table[c][t].machine_cycle.was_requested && !uses_wait_line_) {
+				t++;
+				continue;
+			}
+
+			// If an index placeholder is hit then drop it, and if offsets aren't being added,
+			// then also drop the indexing that follows, which is assumed to be everything
+			// up to and including the next ::CalculateIndexAddress. Coupled to the INDEX() macro.
+			if(table[c][t].type == MicroOp::IndexedPlaceHolder) {
+				t++;
+				if(!add_offsets) {
+					while(table[c][t].type != MicroOp::CalculateIndexAddress) t++;
+					t++;
+				}
+			}
+			target.all_operations.push_back(micro_op(table[c][t]));
+			t++;
+		}
+	}
+
+	// Since the vector won't change again, it's now safe to set pointers.
+	std::size_t c = 0;
+	for(std::size_t index : operation_indices) {
+		target.instructions[c] = &target.all_operations[index];
+		c++;
+	}
+}
+
+void Prototype::copy_program(const TableOp *source, std::vector<MicroOp> &destination) {
+	std::size_t length = 0;
+	while(!is_terminal(source[length].type)) length++;
+	std::size_t pointer = 0;
+	while(true) {
+		// TODO: This test is duplicated from assemble_page; can a better factoring be found?
+		// Skip optional waits if this instance doesn't use the wait line.
+		if(source[pointer].machine_cycle.was_requested && !uses_wait_line_) {
+			pointer++;
+			continue;
+		}
+
+		destination.push_back(micro_op(source[pointer]));
+		if(is_terminal(source[pointer].type)) break;
+		pointer++;
+	}
+}
+
+ProcessorStorage::MicroOp Prototype::micro_op(const TableOp &source) {
+	if(source.type != MicroOp::BusOperation) {
+		return source;
+	}
+
+	// Bus operations refer to one of the distinct bus cycles.
+	auto &count = programs.bus_cycle_count;
+	const auto &cycle = source.machine_cycle;
+	const auto end = std::begin(bus_cycles_) + count;
+	const auto existing = std::find_if(std::begin(bus_cycles_), end, [&](const PartialMachineCycle &rhs) {
+		return
+			cycle.operation == rhs.operation &&
+			cycle.length == rhs.length &&
+			cycle.address == rhs.address &&
+			cycle.value == rhs.value &&
+			cycle.was_requested == rhs.was_requested;
+	});
+	if(existing == end) {
+		// Checked in all builds: overflowing would otherwise silently corrupt the registers that follow.
+		if(count == MaxBusCycles) {
+			throw std::logic_error("Z80 bus cycle storage is too small for the instruction set");
+		}
+		bus_cycles_[count] = cycle;
+		++count;
+	}
+	return MicroOp{MicroOp::BusOperation, &*existing};
+}
+
 bool ProcessorBase::is_starting_new_instruction() const {
 	return
-		current_instruction_page_ == &base_page_ &&
-		scheduled_program_counter_ == &base_page_.fetch_decode_execute[0];
+		current_instruction_page_ == &programs_->base_page &&
+		scheduled_program_counter_ == &programs_->base_page.fetch_decode_execute[0];
 }
 
 bool ProcessorBase::get_is_resetting() const {
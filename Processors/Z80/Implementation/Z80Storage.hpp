@@ -113,9 +113,9 @@ protected:
 			Reset
 		};
 		Type type = Type::Reset;
+		/// For bus operations, a pointer to the relevant entry in @c bus_cycles_.
 		void *source = nullptr;
 		void *destination = nullptr;
-		PartialMachineCycle machine_cycle{};
 	};
 	static constexpr bool is_terminal(const MicroOp::Type type) {
 		return type == MicroOp::MoveToNextProgram || type == MicroOp::DecodeOperation;
@@ -129,8 +129,42 @@ protected:
 		bool is_indexed = false;
 	};
 
+	/*!
+		All microprograms. These are built once per wait-line configuration and shared by
+		every processor with that configuration.
+
+		Any pointers to processor state contained within them refer to a prototype
+		ProcessorStorage, and are mapped to this processor upon use via @c relocate.
+	*/
+	struct Programs {
+		size_t bus_cycle_count = 0;
+
+		std::vector<MicroOp> conditional_call_untaken_program;
+		std::vector<MicroOp> reset_program;
+		std::vector<MicroOp> irq_program[3];
+		std::vector<MicroOp> nmi_program;
+
+		InstructionPage base_page;
+		InstructionPage ed_page;
+		InstructionPage fd_page;
+		InstructionPage dd_page;
+
+		InstructionPage cb_page;
+		InstructionPage fdcb_page;
+		InstructionPage ddcb_page;
+	};
+
 	ProcessorStorage();
-	void install_default_instruction_set();
+	void install_default_instruction_set(bool uses_wait_line);
+
+	/// All distinct bus cycles that appear in @c programs_; these are copied from the prototype
+	/// and relocated upon construction, so as to be ready for use with the bus handler.
+	/// They're placed ahead of the registers to keep the remaining processor state compact.
+	///
+	/// The instruction set currently needs 364 with the wait line, fewer without; exceeding
+	/// this limit is reported by an exception when the instruction set is first assembled.
+	static constexpr size_t MaxBusCycles = 384;
+	PartialMachineCycle bus_cycles_[MaxBusCycles];
 
 	uint8_t a_;
 	RegisterPair16 bc_, de_, hl_;
@@ -174,21 +208,18 @@ protected:
 	uint8_t temp8_;
 
 	const MicroOp *scheduled_program_counter_ = nullptr;
+	const InstructionPage *current_instruction_page_ = nullptr;
 
-	std::vector<MicroOp> conditional_call_untaken_program_;
-	std::vector<MicroOp> reset_program_;
-	std::vector<MicroOp> irq_program_[3];
-	std::vector<MicroOp> nmi_program_;
-	InstructionPage *current_instruction_page_;
+	const Programs *programs_ = nullptr;
+	uintptr_t relocation_ = 0;
 
-	InstructionPage base_page_;
-	InstructionPage ed_page_;
-	InstructionPage fd_page_;
-	InstructionPage dd_page_;
-
-	InstructionPage cb_page_;
-	InstructionPage fdcb_page_;
-	InstructionPage ddcb_page_;
+	/*!
+		@returns @c pointer, which refers to state within the prototype that built @c programs_,
+		adjusted to refer to the same state within this processor.
+	*/
+	template <typename T> T *relocate(T *const pointer) const {
+		return reinterpret_cast<T *>(reinterpret_cast<uintptr_t>(pointer) + relocation_);
+	}
 
 	/*!
 		Gets the flags register.
@@ -225,15 +256,6 @@ protected:
 		carry_result_			= flags;
 	}
 
-	typedef MicroOp InstructionTable[256][30];
-	virtual void assemble_page(InstructionPage &target, InstructionTable &table, bool add_offsets) = 0;
-	virtual void copy_program(const MicroOp *source, std::vector<MicroOp> &destination) = 0;
-
-	void assemble_fetch_decode_execute(InstructionPage &target, int length);
-	void assemble_ed_page(InstructionPage &target);
-	void assemble_cb_page(InstructionPage &target, RegisterPair16 &index, bool add_offsets);
-	void assemble_base_page(InstructionPage &target, RegisterPair16 &index, bool add_offsets, InstructionPage &cb_page);
-
 	// Allow state objects to capture and apply state.
 	friend struct State;
 };
@@ -60,32 +60,32 @@ State::State(const ProcessorBase &src): State() {
 		execution_state.steps_into_phase = int(src.scheduled_program_counter_ - &y[0]);
 	};
 
-	if(contained_by(src.conditional_call_untaken_program_)) {
-		populate(ExecutionState::Phase::UntakenConditionalCall, src.conditional_call_untaken_program_);
-	} else if(contained_by(src.reset_program_)) {
-		populate(ExecutionState::Phase::Reset, src.reset_program_);
-	} else if(contained_by(src.irq_program_[0])) {
-		populate(ExecutionState::Phase::IRQMode0, src.irq_program_[0]);
-	} else if(contained_by(src.irq_program_[1])) {
-		populate(ExecutionState::Phase::IRQMode1, src.irq_program_[1]);
-	} else if(contained_by(src.irq_program_[2])) {
-		populate(ExecutionState::Phase::IRQMode2, src.irq_program_[2]);
-	} else if(contained_by(src.nmi_program_)) {
-		populate(ExecutionState::Phase::NMI, src.nmi_program_);
+	if(contained_by(src.programs_->conditional_call_untaken_program)) {
+		populate(ExecutionState::Phase::UntakenConditionalCall, src.programs_->conditional_call_untaken_program);
+	} else if(contained_by(src.programs_->reset_program)) {
+		populate(ExecutionState::Phase::Reset, src.programs_->reset_program);
+	} else if(contained_by(src.programs_->irq_program[0])) {
+		populate(ExecutionState::Phase::IRQMode0, src.programs_->irq_program[0]);
+	} else if(contained_by(src.programs_->irq_program[1])) {
+		populate(ExecutionState::Phase::IRQMode1, src.programs_->irq_program[1]);
+	} else if(contained_by(src.programs_->irq_program[2])) {
+		populate(ExecutionState::Phase::IRQMode2, src.programs_->irq_program[2]);
+	} else if(contained_by(src.programs_->nmi_program)) {
+		populate(ExecutionState::Phase::NMI, src.programs_->nmi_program);
 	} else {
-		if(src.current_instruction_page_ == &src.base_page_) {
+		if(src.current_instruction_page_ == &src.programs_->base_page) {
 			execution_state.instruction_page = 0;
-		} else if(src.current_instruction_page_ == &src.ed_page_) {
+		} else if(src.current_instruction_page_ == &src.programs_->ed_page) {
 			execution_state.instruction_page = 0xed;
-		} else if(src.current_instruction_page_ == &src.fd_page_) {
+		} else if(src.current_instruction_page_ == &src.programs_->fd_page) {
 			execution_state.instruction_page = 0xfd;
-		} else if(src.current_instruction_page_ == &src.dd_page_) {
+		} else if(src.current_instruction_page_ == &src.programs_->dd_page) {
 			execution_state.instruction_page = 0xdd;
-		} else if(src.current_instruction_page_ == &src.cb_page_) {
+		} else if(src.current_instruction_page_ == &src.programs_->cb_page) {
 			execution_state.instruction_page = 0xcb;
-		} else if(src.current_instruction_page_ == &src.fdcb_page_) {
+		} else if(src.current_instruction_page_ == &src.programs_->fdcb_page) {
 			execution_state.instruction_page = 0xfdcb;
-		} else if(src.current_instruction_page_ == &src.ddcb_page_) {
+		} else if(src.current_instruction_page_ == &src.programs_->ddcb_page) {
 			execution_state.instruction_page = 0xddcb;
 		}
 
@@ -144,33 +144,33 @@ void State::apply(ProcessorBase &target) {
 	target.number_of_cycles_ = HalfCycles(execution_state.half_cycles_into_step);
 
 	switch(execution_state.instruction_page) {
-		default:		target.current_instruction_page_ = &target.base_page_;	break;
-		case 0xed:		target.current_instruction_page_ = &target.ed_page_;	break;
-		case 0xdd:		target.current_instruction_page_ = &target.dd_page_;	break;
-		case 0xcb:		target.current_instruction_page_ = &target.cb_page_;	break;
-		case 0xfd:		target.current_instruction_page_ = &target.fd_page_;	break;
-		case 0xfdcb:	target.current_instruction_page_ = &target.fdcb_page_;	break;
-		case 0xddcb:	target.current_instruction_page_ = &target.ddcb_page_;	break;
+		default:		target.current_instruction_page_ = &target.programs_->base_page;	break;
+		case 0xed:		target.current_instruction_page_ = &target.programs_->ed_page;	break;
+		case 0xdd:		target.current_instruction_page_ = &target.programs_->dd_page;	break;
+		case 0xcb:		target.current_instruction_page_ = &target.programs_->cb_page;	break;
+		case 0xfd:		target.current_instruction_page_ = &target.programs_->fd_page;	break;
+		case 0xfdcb:	target.current_instruction_page_ = &target.programs_->fdcb_page;	break;
+		case 0xddcb:	target.current_instruction_page_ = &target.programs_->ddcb_page;	break;
 	}
 
 	switch(execution_state.phase) {
 		case ExecutionState::Phase::UntakenConditionalCall:
-			target.scheduled_program_counter_ = &target.conditional_call_untaken_program_[0];
+			target.scheduled_program_counter_ = &target.programs_->conditional_call_untaken_program[0];
 		break;
 		case ExecutionState::Phase::Reset:
-			target.scheduled_program_counter_ = &target.reset_program_[0];
+			target.scheduled_program_counter_ = &target.programs_->reset_program[0];
 		break;
 		case ExecutionState::Phase::IRQMode0:
-			target.scheduled_program_counter_ = &target.irq_program_[0][0];
+			target.scheduled_program_counter_ = &target.programs_->irq_program[0][0];
 		break;
 		case ExecutionState::Phase::IRQMode1:
-			target.scheduled_program_counter_ = &target.irq_program_[1][0];
+			target.scheduled_program_counter_ = &target.programs_->irq_program[1][0];
 		break;
 		case ExecutionState::Phase::IRQMode2:
-			target.scheduled_program_counter_ = &target.irq_program_[2][0];
+			target.scheduled_program_counter_ = &target.programs_->irq_program[2][0];
 		break;
 		case ExecutionState::Phase::NMI:
-			target.scheduled_program_counter_ = &target.nmi_program_[0];
+			target.scheduled_program_counter_ = &target.programs_->nmi_program[0];
 		break;
 		case ExecutionState::Phase::FetchDecode:
 			target.scheduled_program_counter_ = &target.current_instruction_page_->fetch_decode_execute[0];
@@ -536,9 +536,6 @@ public:
 
 private:
 	T &bus_handler_;
-
-	void assemble_page(InstructionPage &, InstructionTable &, bool add_offsets);
-	void copy_program(const MicroOp *source, std::vector<MicroOp> &destination);
 };
 
 #include "Implementation/Z80Implementation.hpp"
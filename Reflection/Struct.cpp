@@ -451,6 +451,25 @@ std::vector<uint8_t> Reflection::Struct::serialise() const {
 	return result;
 }
 
+std::vector<uint8_t> Reflection::Struct::serialise_packed() const {
+	std::vector<uint8_t> result;
+	const uint64_t hash = schema_hash();
+	result.insert(result.end(), reinterpret_cast<const uint8_t *>(&hash), reinterpret_cast<const uint8_t *>(&hash + 1));
+	append_packed(result);
+	return result;
+}
+
+bool Reflection::Struct::deserialise_packed(const std::vector<uint8_t> &data) {
+	uint64_t hash;
+	if(data.size() < sizeof(hash)) return false;
+	memcpy(&hash, data.data(), sizeof(hash));
+	if(hash != schema_hash()) return false;
+
+	const uint8_t *source = data.data() + sizeof(hash);
+	const uint8_t *const end = data.data() + data.size();
+	return apply_packed(source, end) && source == end;
+}
+
 bool Reflection::Struct::deserialise(const std::vector<uint8_t> &bson) {
 	return deserialise(bson.data(), bson.size());
 }
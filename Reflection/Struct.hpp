@@ -76,9 +76,37 @@ struct Struct {
 	*/
 	virtual bool should_serialise([[maybe_unused]] const std::string &key) const { return true; }
 
+	/*!
+		Serialises this struct in a packed binary form: a schema hash followed by the value of every declared
+		field in declaration order, without keys or type tags. Values are stored in host byte order so this
+		is intended for fast in-process snapshots; use @c serialise for interchange.
+
+		Supports the same types as @c serialise. @c should_serialise is not consulted.
+	*/
+	std::vector<uint8_t> serialise_packed() const;
+
+	/*!
+		Applies data produced by @c serialise_packed.
+
+		@returns @c true if the data was applied; @c false if it was produced by a struct with a different
+			schema, or is truncated or followed by unused bytes. In the latter cases some fields may already
+			have been applied.
+	*/
+	bool deserialise_packed(const std::vector<uint8_t> &data);
+
+	/*!
+		@returns A hash of the names, types and counts of all fields declared by this struct and,
+			recursively, by any structs it contains.
+	*/
+	virtual uint64_t schema_hash() const { return 0; }
+
 private:
 	void append(std::ostringstream &stream, const std::string &key, const std::type_info *type, size_t offset) const;
 	bool deserialise(const uint8_t *bson, size_t size);
+
+	virtual void append_packed(std::vector<uint8_t> &) const {}
+	virtual bool apply_packed(const uint8_t *&, const uint8_t *) { return false; }
+	template <typename Owner> friend class StructImpl;
 };
 
 /*!
@@ -246,6 +274,34 @@ public:
 		return keys;
 	}
 
+	uint64_t schema_hash() const final {
+		static const uint64_t hash = [this] {
+			// FNV-1a over each field's name, type, count and, for child structs, their own schema.
+			uint64_t hash = 0xcbf2'9ce4'8422'2325;
+			const auto mix = [&](const void *const data, const size_t size) {
+				for(size_t c = 0; c < size; c++) {
+					hash = (hash ^ static_cast<const uint8_t *>(data)[c]) * 0x100'0000'01b3;
+				}
+			};
+			for(const auto field: ordered_fields_) {
+				mix(field->first.data(), field->first.size() + 1);
+
+				const char *const type_name = field->second.type->name();
+				mix(type_name, strlen(type_name) + 1);
+				mix(&field->second.count, sizeof(field->second.count));
+
+				if(*field->second.type == typeid(Reflection::Struct)) {
+					const auto child = reinterpret_cast<const Struct *>(
+						reinterpret_cast<const uint8_t *>(this) + field->second.offset
+					)->schema_hash();
+					mix(&child, sizeof(child));
+				}
+			}
+			return hash;
+		}();
+		return hash;
+	}
+
 protected:
 	/*
 		This interface requires reflective structs to declare all fields;
@@ -339,27 +395,108 @@ private:
 	}
 
 	template <typename Type> void declare_emplace(Type *t, const std::string &name, size_t count = 1) {
-		contents_.emplace(
+		const auto [iterator, did_insert] = contents_.emplace(
 			std::make_pair(
 				name,
 				Field(
 					typeid(Type),
 					reinterpret_cast<uint8_t *>(t) - reinterpret_cast<uint8_t *>(this),
 					sizeof(Type),
-					count
+					count,
+					&Packer<Type>::append,
+					&Packer<Type>::apply
 				)
 			));
+		if(did_insert) {
+			ordered_fields_.push_back(&*iterator);
+		}
 	}
 
+	void append_packed(std::vector<uint8_t> &target) const final {
+		for(const auto field: ordered_fields_) {
+			field->second.append(
+				reinterpret_cast<const uint8_t *>(this) + field->second.offset,
+				field->second.count,
+				target
+			);
+		}
+	}
+
+	bool apply_packed(const uint8_t *&source, const uint8_t *const end) final {
+		for(const auto field: ordered_fields_) {
+			if(!field->second.apply(
+				reinterpret_cast<uint8_t *>(this) + field->second.offset,
+				field->second.count,
+				source,
+				end
+			)) return false;
+		}
+		return true;
+	}
+
+	/// Provides packed serialisation for fields of type @c Type; any type that can't be packed is
+	/// rejected at compile time rather than silently omitted.
+	template <typename Type> struct Packer {
+		static constexpr bool is_struct = std::is_base_of_v<Reflection::Struct, Type>;
+		static constexpr bool is_sized = std::is_same_v<Type, std::string> || std::is_same_v<Type, std::vector<uint8_t>>;
+		static_assert(
+			is_struct || is_sized || std::is_trivially_copyable_v<Type>,
+			"Declared fields must be reflectable structs, strings, byte vectors or trivially copyable"
+		);
+
+		static void append(const uint8_t *const field, const size_t count, std::vector<uint8_t> &target) {
+			if constexpr (is_struct) {
+				static_cast<const Struct *>(reinterpret_cast<const Type *>(field))->append_packed(target);
+			} else if constexpr (is_sized) {
+				for(size_t c = 0; c < count; c++) {
+					const auto &value = reinterpret_cast<const Type *>(field)[c];
+					const auto size = uint32_t(value.size());
+					target.insert(target.end(), reinterpret_cast<const uint8_t *>(&size), reinterpret_cast<const uint8_t *>(&size + 1));
+					target.insert(target.end(), value.begin(), value.end());
+				}
+			} else {
+				target.insert(target.end(), field, field + sizeof(Type) * count);
+			}
+		}
+
+		static bool apply(uint8_t *const field, const size_t count, const uint8_t *&source, const uint8_t *const end) {
+			if constexpr (is_struct) {
+				return static_cast<Struct *>(reinterpret_cast<Type *>(field))->apply_packed(source, end);
+			} else if constexpr (is_sized) {
+				for(size_t c = 0; c < count; c++) {
+					uint32_t size;
+					if(size_t(end - source) < sizeof(size)) return false;
+					memcpy(&size, source, sizeof(size));
+					source += sizeof(size);
+
+					if(size_t(end - source) < size) return false;
+					reinterpret_cast<Type *>(field)[c].assign(source, source + size);
+					source += size;
+				}
+			} else {
+				if(size_t(end - source) < sizeof(Type) * count) return false;
+				memcpy(field, source, sizeof(Type) * count);
+				source += sizeof(Type) * count;
+			}
+			return true;
+		}
+	};
+
 	struct Field {
 		const std::type_info *type;
 		ssize_t offset;
 		size_t size;
 		size_t count;
-		Field(const std::type_info &type, ssize_t offset, size_t size, size_t count) :
-			type(&type), offset(offset), size(size), count(count) {}
+		void (*append)(const uint8_t *, size_t, std::vector<uint8_t> &);
+		bool (*apply)(uint8_t *, size_t, const uint8_t *&, const uint8_t *);
+		Field(
+			const std::type_info &type, ssize_t offset, size_t size, size_t count,
+			decltype(append) append, decltype(apply) apply
+		) :
+			type(&type), offset(offset), size(size), count(count), append(append), apply(apply) {}
 	};
 	static inline std::unordered_map<std::string, Field> contents_;
+	static inline std::vector<const std::pair<const std::string, Field> *> ordered_fields_;
 	static inline std::unordered_map<std::string, std::vector<bool>> permitted_enum_values_;
 };
 
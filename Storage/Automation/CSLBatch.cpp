@@ -0,0 +1,438 @@
+//
+//  CSLBatch.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "CSLBatch.hpp"
+#include "CSL.hpp"
+#include "CPCScanTarget.hpp"
+
+#include "Analyser/Static/StaticAnalyser.hpp"
+#include "Analyser/Static/AmstradCPC/Target.hpp"
+#include "ClockReceiver/TimeTypes.hpp"
+#include "Machines/AmstradCPC/AmstradCPC.hpp"
+#include "Machines/AmstradCPC/Keyboard.hpp"
+#include "Machines/Utility/MachineForTarget.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+using namespace Storage::Automation;
+
+namespace {
+
+/// Writes @c image, which is in the CPC's two-bits-per-channel format, to @c path as a binary PPM.
+bool write_ppm(const std::filesystem::path &path, const CPCScanTarget::Image &image) {
+	std::ofstream file(path, std::ios::binary);
+	if(!file) return false;
+
+	file << "P6\n" << CPCScanTarget::ImageWidth << ' ' << CPCScanTarget::ImageHeight << "\n255\n";
+
+	std::vector<uint8_t> pixels;
+	pixels.reserve(image.size() * 3);
+	for(const auto pixel: image) {
+		pixels.push_back(uint8_t(((pixel >> 4) & 3) * 85));
+		pixels.push_back(uint8_t(((pixel >> 2) & 3) * 85));
+		pixels.push_back(uint8_t(((pixel >> 0) & 3) * 85));
+	}
+	file.write(reinterpret_cast<const char *>(pixels.data()), std::streamsize(pixels.size()));
+	return bool(file);
+}
+
+/// @returns @c field as a quoted CSV field, with any quotation marks doubled.
+std::string csv_field(const std::string &field) {
+	std::string result = "\"";
+	for(const auto c: field) {
+		if(c == '"') result += '"';
+		result += c;
+	}
+	return result + '"';
+}
+
+bool is_csl(const std::filesystem::path &path) {
+	std::string extension = path.extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return char(tolower(c)); });
+	return extension == ".csl";
+}
+
+/*!
+	Executes a single script, and any that it loads, against a lazily-created CPC.
+*/
+class Runner: public AmstradCPC::Machine::SSMDelegate {
+public:
+	Runner(
+		const std::filesystem::path &root,
+		const std::filesystem::path &output,
+		const ROMMachine::ROMFetcher &rom_fetcher,
+		CSL::BatchResult &result
+	) : root_(root), output_(output), rom_fetcher_(rom_fetcher), result_(result) {
+		target_.catch_ssm_codes = true;
+		target_.model = Target::Model::CPC6128;
+	}
+
+	void run(const std::filesystem::path &script) {
+		using Type = CSL::Instruction::Type;
+
+		// Guard against scripts that load themselves, directly or otherwise.
+		std::error_code error;
+		auto canonical_script = std::filesystem::weakly_canonical(script, error);
+		if(error) canonical_script = script;
+		if(std::find(active_scripts_.begin(), active_scripts_.end(), canonical_script) != active_scripts_.end()) {
+			throw std::string("Script loads itself: ") + script.filename().string();
+		}
+		if(active_scripts_.size() >= MaximumScriptDepth) {
+			throw std::string("Scripts nested too deeply at ") + script.filename().string();
+		}
+		active_scripts_.push_back(canonical_script);
+
+		const auto script_directory = script.parent_path();
+		const auto steps = CSL::parse(script.string());
+
+		for(const auto &step: steps) {
+			switch(step.type) {
+				case Type::Version:
+					if(std::get<std::string>(step.argument) != "1.0") {
+						note("Unrecognised file version " + std::get<std::string>(step.argument));
+					}
+				break;
+
+				case Type::CRTCSelect:
+					// The CRTC type isn't yet selectable; it is nevertheless retained for screenshot names.
+					crtc_ = int(std::get<uint64_t>(step.argument));
+				break;
+
+				case Type::Reset: {
+					// A machine that hasn't yet been created will start from reset anyway.
+					if(!machine_) break;
+
+					// Resets are hard unless specified otherwise.
+					const auto *const type = std::get_if<CSL::Reset>(&step.argument);
+					auto *const hard_resettable = machine_->hard_resettable();
+					auto *const soft_resettable = machine_->soft_resettable();
+					if(hard_resettable && (!type || *type == CSL::Reset::Hard)) {
+						hard_resettable->hard_reset();
+					} else if(soft_resettable) {
+						soft_resettable->soft_reset();
+					} else {
+						note("Machine can't be reset");
+					}
+				} break;
+
+				case Type::Wait:
+					delay(std::get<uint64_t>(step.argument));
+				break;
+
+				case Type::WaitVsyncOnOff: {
+					machine();
+					const auto frame = scan_target_.frames();
+					while(scan_target_.frames() == frame && delay(1'000)) {}
+				} break;
+
+				case Type::WaitSSM0000:
+					// As per SSMDelegate::perform, there's no means yet to unblock this
+					// so it is treated as a no-op.
+				break;
+
+				case Type::SetDiskDir:
+					disk_directory_ = script_directory / std::get<std::string>(step.argument);
+				break;
+
+				case Type::DiskInsert: {
+					const auto &disk = std::get<CSL::DiskInsert>(step.argument);
+					if(disk.drive != 0) {
+						note("Only drive A is supported");
+						break;
+					}
+
+					disk_path_ = locate(disk.file, script_directory);
+					if(disk_path_.empty()) {
+						throw std::string("Disk not found: ") + disk.file;
+					}
+
+					if(machine_) {
+						machine_->media_target()->insert_media(Analyser::Static::GetMedia(disk_path_.string()));
+					}
+				} break;
+
+				case Type::KeyDelay:
+					key_delay_ = std::get<CSL::KeyDelay>(step.argument);
+				break;
+
+				case Type::KeyOutput: {
+					auto &key_target = *machine().keyboard_machine();
+
+					const auto &events = std::get<std::vector<CSL::KeyEvent>>(step.argument);
+					bool last_down = false;
+					for(const auto &event: events) {
+						// Apply the interpress delay before if this is a second consecutive press;
+						// if this is a release then apply the regular key delay.
+						if(event.down && !last_down) {
+							delay(key_delay_.interpress_delay);
+						} else if(!event.down) {
+							delay(key_delay_.press_delay);
+						}
+
+						key_target.set_key_state(event.key, event.down);
+						last_down = event.down;
+
+						// If this was the release of a carriage return, wait some more after release.
+						if(
+							!event.down &&
+							key_delay_.carriage_return_delay &&
+							(event.key == AmstradCPC::Key::Enter || event.key == AmstradCPC::Key::Return)
+						) {
+							delay(*key_delay_.carriage_return_delay);
+						}
+					}
+				} break;
+
+				case Type::LoadCSL: {
+					const auto name = locate(std::get<std::string>(step.argument) + ".csl", script_directory);
+					if(name.empty()) {
+						throw std::string("Script not found: ") + std::get<std::string>(step.argument);
+					}
+					run(name);
+				} break;
+
+				case Type::SetScreenshotName:
+					screenshot_name_ = std::get<std::string>(step.argument);
+				break;
+
+				case Type::SetScreenshotDir:
+				case Type::SetSnapshotDir:
+					// Output locations are determined by the batch.
+				break;
+
+				case Type::Screenshot:
+					if(std::get<CSL::ScreenshotOrSnapshot>(step.argument) == CSL::ScreenshotOrSnapshot::WaitForVSync) {
+						machine();
+						scan_target_.request_capture();
+						while(scan_target_.capture_pending() && delay(1'000)) {}
+						write(screenshot_name_ + std::to_string(screenshot_index_++), scan_target_.captured_image());
+					} else {
+						write(screenshot_name_ + std::to_string(screenshot_index_++), scan_target_.image());
+					}
+				break;
+
+				default:
+					note("Unsupported instruction " + std::to_string(int(step.type)));
+				break;
+			}
+		}
+
+		active_scripts_.pop_back();
+	}
+
+	void perform(const uint16_t code) override {
+		if(!code) {
+			// A code of 0000 is supposed to end a wait0000 command; at present
+			// there seem to be no wait0000 commands to unblock.
+			return;
+		}
+
+		char name[16];
+		snprintf(name, sizeof(name), "CLK_%d_%04x", crtc_, code);
+		write(name, scan_target_.image());
+	}
+
+private:
+	using Target = Analyser::Static::AmstradCPC::Target;
+
+	const std::filesystem::path &root_;
+	const std::filesystem::path &output_;
+	const ROMMachine::ROMFetcher &rom_fetcher_;
+	CSL::BatchResult &result_;
+
+	Target target_;
+	CPCScanTarget scan_target_;
+	std::unique_ptr<Machine::DynamicMachine> machine_;
+
+	CSL::KeyDelay key_delay_{.press_delay = 50'000, .interpress_delay = 50'000, .carriage_return_delay = {}};
+	std::filesystem::path disk_directory_;
+	std::filesystem::path disk_path_;
+	std::string screenshot_name_ = "screenshot";
+	int screenshot_index_ = 0;
+	int crtc_ = 0;
+
+	/// Never more than ten minutes of emulated time are spent in any single script; this
+	/// bounds the cost of a script that waits for a vsync that never comes, for example.
+	static constexpr uint64_t MaximumMicroseconds = 600'000'000;
+	uint64_t microseconds_ = 0;
+
+	/// Scripts may load other scripts, but not themselves and only up to a fixed depth.
+	static constexpr size_t MaximumScriptDepth = 16;
+	std::vector<std::filesystem::path> active_scripts_;
+
+	Machine::DynamicMachine &machine() {
+		if(!machine_) {
+			Machine::Error error;
+			machine_ = Machine::MachineForTarget(target_, rom_fetcher_, error);
+			if(!machine_) {
+				throw std::string("Unable to create machine");
+			}
+
+			static_cast<AmstradCPC::Machine *>(machine_->raw_pointer())->set_ssm_delegate(this);
+			machine_->scan_producer()->set_scan_target(&scan_target_);
+
+			if(!disk_path_.empty()) {
+				machine_->media_target()->insert_media(Analyser::Static::GetMedia(disk_path_.string()));
+			}
+		}
+		return *machine_;
+	}
+
+	/// Runs the machine for @c micros microseconds. @returns @c false if the time limit has been reached.
+	bool delay(const uint64_t micros) {
+		if(microseconds_ >= MaximumMicroseconds) {
+			return false;
+		}
+		microseconds_ += micros;
+		result_.emulated_seconds = double(microseconds_) / 1'000'000.0;
+
+		machine().timed_machine()->run_for(double(micros) / 1'000'000.0);
+		return true;
+	}
+
+	void note(const std::string &note) {
+		if(std::find(result_.notes.begin(), result_.notes.end(), note) == result_.notes.end()) {
+			result_.notes.push_back(note);
+		}
+	}
+
+	/// Looks for @c name in the current disk directory, then alongside the current script, then at the batch root.
+	std::filesystem::path locate(const std::string &name, const std::filesystem::path &script_directory) {
+		for(const auto &directory: {disk_directory_, script_directory, root_}) {
+			if(directory.empty()) continue;
+
+			// Permit case-insensitive matches, as script names are often uppercase on disk.
+			const auto exact = directory / name;
+			if(std::filesystem::exists(exact)) return exact;
+
+			std::error_code error;
+			for(const auto &entry: std::filesystem::directory_iterator(directory, error)) {
+				const auto candidate = entry.path().filename().string();
+				if(std::equal(
+					candidate.begin(), candidate.end(),
+					name.begin(), name.end(),
+					[](char a, char b) { return tolower(a) == tolower(b); })
+				) {
+					return entry.path();
+				}
+			}
+		}
+		return {};
+	}
+
+	void write(const std::string &name, const CPCScanTarget::Image &image) {
+		std::error_code error;
+		std::filesystem::create_directories(output_, error);
+		if(write_ppm(output_ / (name + ".ppm"), image)) {
+			++result_.screenshots;
+		} else {
+			note("Unable to write " + name);
+		}
+	}
+};
+
+}
+
+std::vector<CSL::BatchResult> CSL::run_batch(
+	const std::string &directory,
+	const std::string &output_directory,
+	const ROMMachine::ROMFetcher &rom_fetcher,
+	unsigned threads
+) {
+	const std::filesystem::path root(directory);
+	const std::filesystem::path output(output_directory);
+
+	// Gather scripts.
+	std::vector<std::filesystem::path> scripts;
+	std::error_code error;
+	for(const auto &entry: std::filesystem::recursive_directory_iterator(root, error)) {
+		if(entry.is_regular_file() && is_csl(entry.path())) {
+			scripts.push_back(entry.path());
+		}
+	}
+	std::sort(scripts.begin(), scripts.end());
+
+	std::vector<BatchResult> results(scripts.size());
+	for(size_t c = 0; c < scripts.size(); c++) {
+		results[c].script = std::filesystem::relative(scripts[c], root).generic_string();
+	}
+
+	// Machines are otherwise independent, but ROM fetchers are usually written with
+	// only a single caller in mind.
+	std::mutex rom_mutex;
+	const ROMMachine::ROMFetcher serial_fetcher = [&](const ROM::Request &request) {
+		std::lock_guard lock(rom_mutex);
+		return rom_fetcher(request);
+	};
+
+	// Hand out scripts to a fixed pool of threads.
+	std::atomic<size_t> next_script = 0;
+	const auto worker = [&] {
+		while(true) {
+			const size_t index = next_script++;
+			if(index >= scripts.size()) return;
+
+			auto &result = results[index];
+			auto script_output = output / result.script;
+			script_output.replace_extension();
+
+			const auto start_time = ::Time::nanos_now();
+			try {
+				Runner runner(root, script_output, serial_fetcher, result);
+				runner.run(scripts[index]);
+				result.completed = true;
+			} catch(const std::string &reason) {
+				result.notes.push_back(reason);
+			} catch(CSL::Errors) {
+				result.notes.push_back("Unable to parse");
+			} catch(const std::exception &exception) {
+				result.notes.push_back(exception.what());
+			}
+			result.host_seconds = ::Time::seconds(::Time::nanos_now() - start_time);
+		}
+	};
+
+	if(!threads) {
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+	threads = unsigned(std::min(size_t(threads), scripts.size()));
+
+	std::vector<std::thread> pool;
+	for(unsigned c = 1; c < threads; c++) {
+		pool.emplace_back(worker);
+	}
+	worker();
+	for(auto &thread: pool) {
+		thread.join();
+	}
+
+	// Write a summary.
+	std::filesystem::create_directories(output, error);
+	std::ofstream summary(output / "timings.csv");
+	summary << "script,completed,emulated seconds,host seconds,screenshots,notes\n";
+	for(const auto &result: results) {
+		std::string notes;
+		for(const auto &note: result.notes) {
+			if(!notes.empty()) notes += "; ";
+			notes += note;
+		}
+
+		summary << csv_field(result.script) << ',' << (result.completed ? "yes" : "no") << ',';
+		summary << result.emulated_seconds << ',' << result.host_seconds << ',' << result.screenshots << ',';
+		summary << csv_field(notes) << '\n';
+	}
+
+	return results;
+}
@@ -0,0 +1,62 @@
+//
+//  CSLBatch.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "Machines/ROMMachine.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Storage::Automation::CSL {
+
+/// Describes the outcome of running a single CSL script.
+struct BatchResult {
+	/// The path of the script, relative to the batch directory.
+	std::string script;
+
+	/// @c true if the script ran to completion; @c false if it couldn't be parsed, the machine couldn't
+	/// be built or the script referenced media that couldn't be found.
+	bool completed = false;
+
+	/// The quantity of emulated time for which the script ran, in seconds.
+	double emulated_seconds = 0.0;
+
+	/// The host time that the script took, in seconds.
+	double host_seconds = 0.0;
+
+	/// The number of screenshots written.
+	int screenshots = 0;
+
+	/// Any problems encountered, such as unsupported instructions.
+	std::vector<std::string> notes;
+};
+
+/*!
+	Runs every CSL script found within @c directory, including its subdirectories, each against its own
+	Amstrad CPC, across @c threads threads or one per hardware thread if @c threads is zero.
+	Machines run without any real-time throttling and without audio or video output.
+
+	Screenshots — both those requested via @c screenshot and those triggered by SSM codes — are
+	written as binary PPMs to a subdirectory of @c output_directory named after each script.
+	Screenshot and snapshot directories specified by scripts are ignored.
+
+	A summary of all results is written to @c timings.csv within @c output_directory.
+
+	@c rom_fetcher is called serially, so need not be thread safe.
+
+	@returns The results for each script, sorted by script name.
+*/
+std::vector<BatchResult> run_batch(
+	const std::string &directory,
+	const std::string &output_directory,
+	const ROMMachine::ROMFetcher &rom_fetcher,
+	unsigned threads = 0
+);
+
+}
@@ -40,6 +40,7 @@ ClockingHint::Preference Controller::preferred_clocking() const {
 }
 
 void Controller::run_for(const Cycles cycles) {
+	const Profiler::Scope scope(Profiler::Component::Disk, cycles.get());
 	for(auto &drive: drives_) {
 		drive->run_for(cycles);
 	}
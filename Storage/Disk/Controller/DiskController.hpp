@@ -14,6 +14,7 @@
 
 #include "ClockReceiver/ClockReceiver.hpp"
 #include "ClockReceiver/ClockingHintSource.hpp"
+#include "ClockReceiver/Profiler.hpp"
 
 #include <concepts>
 
@@ -32,6 +33,10 @@ class Controller:
 	public ClockingHint::Source,
 	private Drive::EventDelegate,
 	private ClockingHint::Observer {
+public:
+	/// When profiling, time spent running any controller is charged to the disk.
+	static constexpr auto ProfilerComponent = Profiler::Component::Disk;
+
 protected:
 	/*!
 		Constructs a @c Controller that will be run at @c clock_rate.
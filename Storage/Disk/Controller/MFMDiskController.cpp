@@ -9,6 +9,7 @@
 #include "MFMDiskController.hpp"
 
 #include "Storage/Disk/Encodings/MFM/Constants.hpp"
+#include "Storage/Disk/Track/TrackSerialiser.hpp"
 
 using namespace Storage::Disk;
 
@@ -42,6 +43,42 @@ bool MFMController::get_is_double_density() {
 void MFMController::set_data_mode(const DataMode mode) {
 	data_mode_ = mode;
 	shifter_.set_should_obey_syncs(mode == DataMode::Scanning);
+
+	// Any write may modify the track in place, so forget its sectors.
+	if(mode == DataMode::Writing) {
+		track_sectors_.track = nullptr;
+	}
+}
+
+void MFMController::set_is_fast_sector_search(const bool is_fast_sector_search) {
+	is_fast_sector_search_ = is_fast_sector_search;
+	if(!is_fast_sector_search) {
+		track_sectors_ = TrackSectors{};
+	}
+}
+
+bool MFMController::get_is_fast_sector_search() const {
+	return is_fast_sector_search_;
+}
+
+const MFMController::TrackSectors &MFMController::sectors_under_head() {
+	const auto track = get_drive().track_under_head();
+	if(track == track_sectors_.track && is_double_density_ == track_sectors_.is_double_density) {
+		return track_sectors_;
+	}
+
+	track_sectors_.track = track;
+	track_sectors_.is_double_density = is_double_density_;
+	track_sectors_.map.clear();
+	track_sectors_.length = 1;
+	if(track) {
+		using namespace Storage::Encodings::MFM;
+		const auto density = is_double_density_ ? Density::Double : Density::Single;
+		const auto segment = track_serialisation(*track, bit_length(density));
+		track_sectors_.map = sectors_from_segment(segment, density);
+		track_sectors_.length = std::max(segment.data.size(), size_t(1));
+	}
+	return track_sectors_;
 }
 
 MFMController::Token MFMController::get_latest_token() {
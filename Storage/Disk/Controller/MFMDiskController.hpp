@@ -11,8 +11,14 @@
 #include "DiskController.hpp"
 #include "Numeric/CRC.hpp"
 #include "ClockReceiver/ClockReceiver.hpp"
+#include "Storage/Disk/Encodings/MFM/SegmentParser.hpp"
 #include "Storage/Disk/Encodings/MFM/Shifter.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <memory>
+
 namespace Storage::Disk {
 
 /*!
@@ -23,6 +29,18 @@ class MFMController: public Controller {
 public:
 	MFMController(Cycles clock_rate);
 
+	/*!
+		Enables or disables fast sector searches. While enabled, whenever a subclass begins searching for a
+		sector that is present on the current track, the disk is rotated to just before that sector's ID
+		rather than the controller waiting for it to arrive.
+
+		This is a user-optional fast-loading mechanism; no real controller or drive can do this.
+	*/
+	void set_is_fast_sector_search(bool);
+
+	/// @returns @c true if fast sector searches are enabled; @c false otherwise.
+	bool get_is_fast_sector_search() const;
+
 protected:
 	/// Indicates whether the controller should try to decode double-density MFM content, or single-density FM content.
 	void set_is_double_density(bool);
@@ -143,7 +161,53 @@ protected:
 	*/
 	void write_start_of_track();
 
+	/*!
+		If fast sector searches are enabled, rotates the disk so that the ID of the next sector on the current
+		track for which @c predicate returns @c true will be found almost immediately. Does nothing if fast sector
+		searches are disabled, if there is no such sector or if it is already about to be found.
+	*/
+	template <typename PredicateT>
+	requires std::predicate<PredicateT, const Encodings::MFM::Sector &>
+	void skip_to_sector(PredicateT &&predicate) {
+		if(!is_fast_sector_search_) return;
+
+		const auto &sectors = sectors_under_head();
+		if(sectors.map.empty()) return;
+
+		const float rotation = get_drive().get_rotation();
+		float nearest = 1.0f;
+		for(const auto &[location, sector]: sectors.map) {
+			if(!predicate(sector)) continue;
+
+			float distance = float(location) / float(sectors.length) - rotation;
+			distance -= std::floor(distance);
+			nearest = std::min(nearest, distance);
+		}
+
+		const float lead = float(SkipLeadBits) / float(sectors.length);
+		if(nearest < 1.0f && nearest > lead) {
+			get_drive().set_rotation(rotation + nearest - lead);
+		}
+	}
+
 private:
+	// Fast sector search state.
+	bool is_fast_sector_search_ = false;
+
+	// The number of bits before a sector's ID mark is detected at which to position the head
+	// after a skip; 24 bytes is enough to cover the synchronisation marks and zeroes, plus
+	// a few bytes of the preceding gap to allow the PLL to lock.
+	static constexpr size_t SkipLeadBits = 24 * 16;
+
+	struct TrackSectors {
+		std::shared_ptr<Track> track;
+		bool is_double_density = false;
+
+		Encodings::MFM::SectorMap map;
+		size_t length = 1;
+	} track_sectors_;
+	const TrackSectors &sectors_under_head();
+
 	// Storage::Disk::Controller
 	virtual void process_input_bit(int value);
 	virtual void process_index_hole();
@@ -136,6 +136,23 @@ std::shared_ptr<Track> Drive::step_to(const HeadPosition offset) {
 	return track_;
 }
 
+std::shared_ptr<Track> Drive::track_under_head() {
+	if(track_) return track_;
+	return get_track();
+}
+
+void Drive::set_rotation(const float rotation) {
+	if(!disk_ || !is_reading_) return;
+
+	cycles_since_index_hole_ =
+		Cycles::IntType((rotation - std::floor(rotation)) * float(cycles_per_revolution_)) % cycles_per_revolution_;
+
+	// Discard the time until whatever event was previously next and pick up the track from the new position.
+	reset_timer();
+	random_interval_ = 0.0f;
+	setup_track();
+}
+
 void Drive::set_head(int head) {
 	head = std::min(head, available_heads_ - 1);
 	if(head != head_) {
@@ -184,6 +184,22 @@ public:
 	*/
 	std::shared_ptr<Track> step_to(HeadPosition offset);
 
+	/*!
+		@returns the track currently under the head, or @c nullptr if there is no disk.
+
+		Like @c step_to this is offered for the benefit of user-optional fast-loading mechanisms **ONLY**.
+	*/
+	std::shared_ptr<Track> track_under_head();
+
+	/*!
+		Instantaneously rotates the disk so that the head is at @c rotation, as per @c get_rotation,
+		without passing over any intervening events. Has no effect while writing.
+
+		This is also **NOT A REALISTIC DRIVE FUNCTION**, offered for user-optional fast-loading
+		mechanisms **ONLY**.
+	*/
+	void set_rotation(float rotation);
+
 	/*!
 		Alters the rotational velocity of this drive.
 	*/
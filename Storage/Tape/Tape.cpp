@@ -128,6 +128,7 @@ void TapePlayer::complete_pulse() {
 
 void TapePlayer::run_for(const Cycles cycles) {
 	if(has_tape()) {
+		const Profiler::Scope scope(Profiler::Component::Tape, cycles.get());
 		TimedEventLoop::run_for(cycles);
 	}
 }
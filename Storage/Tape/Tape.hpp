@@ -10,6 +10,7 @@
 
 #include "ClockReceiver/ClockReceiver.hpp"
 #include "ClockReceiver/ClockingHintSource.hpp"
+#include "ClockReceiver/Profiler.hpp"
 
 #include "Storage/TimedEventLoop.hpp"
 
@@ -120,6 +121,9 @@ protected:
 */
 class TapePlayer: public TimedEventLoop, public ClockingHint::Source {
 public:
+	/// When profiling, time spent running any tape player is charged to the tape.
+	static constexpr auto ProfilerComponent = Profiler::Component::Tape;
+
 	TapePlayer(int input_clock_rate);
 	virtual ~TapePlayer() = default;
 
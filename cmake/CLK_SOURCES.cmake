@@ -196,6 +196,8 @@ set(CLK_SOURCES
 
 	SignalProcessing/FIRFilter.cpp
 
+	Storage/Automation/CSL.cpp
+	Storage/Automation/CSLBatch.cpp
 	Storage/Cartridge/Cartridge.cpp
 	Storage/Cartridge/Encodings/CommodoreROM.cpp
 	Storage/Cartridge/Formats/BinaryDump.cpp